@@ -77,6 +77,21 @@ public:
     }
 };
 
+/**
+ * Participant discovery protocol used by a RTPSParticipant.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+enum class DiscoveryProtocol_t
+{
+    //! Every RTPSParticipant announces itself to all the others (SPDP).
+    SIMPLE,
+    //! The RTPSParticipant announces itself only to its discovery servers, which introduce it to the
+    //! RTPSParticipants sharing topics with it.
+    CLIENT,
+    //! The RTPSParticipant acts as discovery server of the clients announcing themselves to it.
+    SERVER
+};
+
 /**
  * Class BuiltinAttributes, to define the behavior of the RTPSParticipant builtin protocols.
  * @ingroup RTPS_ATTRIBUTES_MODULE
@@ -143,6 +158,12 @@ class BuiltinAttributes
         //! Mutation tries if the port is being used.
         uint32_t mutation_tries;
 
+        //! Participant discovery protocol, when use_SIMPLE_RTPSParticipantDiscoveryProtocol is true.
+        DiscoveryProtocol_t discoveryProtocol;
+
+        //! Metatraffic unicast locators of the discovery servers, used by CLIENT participants.
+        LocatorList_t discoveryServerList;
+
         BuiltinAttributes()
         {
             use_SIMPLE_RTPSParticipantDiscoveryProtocol = true;
@@ -156,6 +177,7 @@ class BuiltinAttributes
             readerHistoryMemoryPolicy = MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE;
             writerHistoryMemoryPolicy = MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE;
             mutation_tries = 100u;
+            discoveryProtocol = DiscoveryProtocol_t::SIMPLE;
         }
         virtual ~BuiltinAttributes() {}
 
@@ -176,7 +198,9 @@ class BuiltinAttributes
                    (this->readerHistoryMemoryPolicy == b.readerHistoryMemoryPolicy) &&
                    (this->writerHistoryMemoryPolicy == b.writerHistoryMemoryPolicy) &&
                    (this->m_staticEndpointXMLFilename == b.m_staticEndpointXMLFilename) &&
-                   (this->mutation_tries == b.mutation_tries);
+                   (this->mutation_tries == b.mutation_tries) &&
+                   (this->discoveryProtocol == b.discoveryProtocol) &&
+                   (this->discoveryServerList == b.discoveryServerList);
         }
 
         /**
@@ -211,6 +235,9 @@ class RTPSParticipantAttributes
             listenSocketBufferSize = 0;
             participantID = -1;
             useBuiltinTransports = true;
+            asyncWriterThreads = 1;
+            intraprocessDelivery = false;
+            heartbeatCoalescingPeriod = c_TimeZero;
         }
 
         virtual ~RTPSParticipantAttributes() {}
@@ -228,6 +255,9 @@ class RTPSParticipantAttributes
                    (this->participantID == b.participantID) &&
                    (this->throughputController == b.throughputController) &&
                    (this->useBuiltinTransports == b.useBuiltinTransports) &&
+                   (this->asyncWriterThreads == b.asyncWriterThreads) &&
+                   (this->intraprocessDelivery == b.intraprocessDelivery) &&
+                   (this->heartbeatCoalescingPeriod == b.heartbeatCoalescingPeriod) &&
                    (this->properties == b.properties);
         }
 
@@ -275,6 +305,28 @@ class RTPSParticipantAttributes
         //!Set as false to disable the default UDPv4 implementation.
         bool useBuiltinTransports;
 
+        /*!
+         * @brief Number of threads sending on behalf of the asynchronous writers of the participant.
+         * Each writer is served by a single thread at a time, so more threads only help with several async writers.
+         * Default value: 1.
+         */
+        uint32_t asyncWriterThreads;
+
+        /*!
+         * @brief Set as true to let the user writers of the participant deliver their changes directly to the
+         * matched readers living in the same process, instead of sending them through the transports.
+         * Default value: false.
+         */
+        bool intraprocessDelivery;
+
+        /*!
+         * @brief Period used to align the periodic heartbeats of the reliable writers of the participant.
+         * When not zero, the heartbeat of each writer is delayed to the next multiple of this period, and the
+         * heartbeats of all the writers due at the same time are sent together, in a single message per destination.
+         * Default value: zero (each writer sends its own heartbeats).
+         */
+        Duration_t heartbeatCoalescingPeriod;
+
         //! Property policies
         PropertyPolicy properties;
 
@@ -48,13 +48,19 @@ public:
     bool operator==(const ReaderTimes& b) const
     {
         return (this->initialAcknackDelay == b.initialAcknackDelay)  &&
-               (this->heartbeatResponseDelay == b.heartbeatResponseDelay);
+               (this->heartbeatResponseDelay == b.heartbeatResponseDelay) &&
+               (this->acknackCoalescingWindow == b.acknackCoalescingWindow);
     }
 
     //!Initial AckNack delay. Default value 70ms.
     Duration_t initialAcknackDelay;
     //!Delay to be applied when a hearbeat message is received, default value 5ms.
     Duration_t heartbeatResponseDelay;
+    /**
+     * Time the responses to heartbeats are held, so the ACKNACK and NACKFRAG submessages sent to the same
+     * locators are grouped on a single message. Default value 0 (each response is sent on its own message).
+     */
+    Duration_t acknackCoalescingWindow;
 };
 
 /**
@@ -229,6 +229,20 @@ class EDP
          */
         bool pairingWriter(RTPSWriter* W, const ParticipantProxyData& pdata, const WriterProxyData& wdata);
 
+        /**
+         * Look for a local user writer. Should be called with the participant mutex locked.
+         * @param writer_guid GUID of the writer.
+         * @return Pointer to the writer, or nullptr if it is not a local user writer.
+         */
+        RTPSWriter* find_local_writer(const GUID_t& writer_guid);
+
+        /**
+         * Look for a local user reader. Should be called with the participant mutex locked.
+         * @param reader_guid GUID of the reader.
+         * @return Pointer to the reader, or nullptr if it is not a local user reader.
+         */
+        RTPSReader* find_local_reader(const GUID_t& reader_guid);
+
         bool checkTypeIdentifier(const WriterProxyData* wdata, const ReaderProxyData* rdata) const;
 
         bool checkTypeIdentifier(const eprosima::fastrtps::types::TypeIdentifier * wti,
@@ -35,6 +35,7 @@ class EDPSimplePUBListener;
 class EDPSimpleSUBListener;
 class ReaderHistory;
 class WriterHistory;
+struct CacheChange_t;
 
 
 /**
@@ -135,6 +136,14 @@ class EDPSimple : public EDP
      */
     bool createSEDPEndpoints();
 
+    /**
+     * Replaces the announcement of a local endpoint in the history of a SEDP writer.
+     * When the serialized data did not change, the previous announcement is kept and nothing is sent.
+     * @param writer SEDP writer announcing the endpoint.
+     * @param change Change with the serialized proxy data of the endpoint.
+     */
+    void publishLocalProxyData(t_p_StatefulWriter& writer, CacheChange_t* change);
+
 #if HAVE_SECURITY
     bool create_sedp_secure_endpoints();
 
@@ -0,0 +1,109 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPServer.h
+ *
+ */
+
+#ifndef PDPSERVER_H_
+#define PDPSERVER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "PDPSimple.h"
+#include "../../../common/CacheChange.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+/**
+ * Class PDPServer that implements the server side of the discovery server protocol.
+ *
+ * Clients announce themselves only to their servers, instead of to every other RTPSParticipant. The server
+ * discovers the endpoints of its clients through the EDP, and when two clients have endpoints on the same topic
+ * it relays to each one the SPDP data of the other, so they discover each other and run the EDP directly.
+ * Clients without common topics are never introduced, so the discovery traffic grows with the number of
+ * RTPSParticipants sharing topics instead of with the square of the number of RTPSParticipants.
+ *@ingroup DISCOVERY_MODULE
+ */
+class PDPServer : public PDPSimple
+{
+    public:
+    /**
+     * Constructor
+     * @param builtin Pointer to the BuiltinProcols object.
+     */
+    PDPServer(BuiltinProtocols* builtin);
+    virtual ~PDPServer();
+
+    /**
+     * Also relays again the SPDP data of every introduced client, as relays are sent best-effort and may be lost.
+     * @param new_change If true a new change (with new seqNum) is created and sent; if false the last change is re-sent
+     * @param dispose Sets change kind to NOT_ALIVE_DISPOSED_UNREGISTERED
+     */
+    void announceParticipantState(bool new_change, bool dispose = false) override;
+
+    protected:
+
+    void remoteParticipantDataReceived(ParticipantProxyData* pdata,
+            const SequenceNumber_t& sequence_number) override;
+
+    void readerProxyDataAdded(ReaderProxyData* rdata) override;
+
+    void writerProxyDataAdded(WriterProxyData* wdata) override;
+
+    void participantProxyDataRemoved(ParticipantProxyData* pdata) override;
+
+    private:
+
+    /**
+     * Introduces two clients to each other, unless they were already introduced.
+     * @param first GUID prefix of one of the clients.
+     * @param second GUID prefix of the other client.
+     */
+    void introduceClients(const GuidPrefix_t& first, const GuidPrefix_t& second);
+
+    /**
+     * Sends the last SPDP data received from a client to another one, as if it was sent by the first client.
+     * @param pdata Data of the client being introduced.
+     * @param destination Data of the client receiving the SPDP data.
+     */
+    void relayParticipantData(ParticipantProxyData& pdata, const ParticipantProxyData& destination);
+
+    /**
+     * Relays the SPDP data of a client to all the clients it was introduced to.
+     * @param client GUID prefix of the client.
+     */
+    void relayToIntroducedClients(const GuidPrefix_t& client);
+
+    //!Sequence number of the last SPDP data received from each client.
+    std::unordered_map<GuidPrefix_t, SequenceNumber_t, GuidPrefixHash> m_clientSequenceNumbers;
+    //!Clients each client has been introduced to. Protected by the PDP mutex, like the other members.
+    std::unordered_map<GuidPrefix_t, std::unordered_set<GuidPrefix_t, GuidPrefixHash>, GuidPrefixHash>
+        m_introducedClients;
+    //!Change used to serialize the SPDP data being relayed.
+    CacheChange_t m_relayChange;
+    //!Message used to relay the SPDP data.
+    CDRMessage_t m_relayMessage;
+};
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
+#endif
+#endif /* PDPSERVER_H_ */
@@ -21,8 +21,16 @@
 #define PDPSIMPLE_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastrtps/config.h>
 #include <mutex>
+#if HAVE_CXX14
+#include <shared_mutex>
+#endif
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include "../../../common/Guid.h"
+#include "../../../common/SequenceNumber.h"
 #include "../../../attributes/RTPSParticipantAttributes.h"
 #include "../../../messages/CDRMessage.h"
 
@@ -51,8 +59,8 @@ class PDPSimpleListener;
  */
 class PDPSimple
 {
-    friend class ResendRTPSParticipantProxyDataPeriod;
-    friend class RemoteRTPSParticipantLeaseDuration;
+    friend class ResendParticipantProxyDataPeriod;
+    friend class RemoteParticipantLeaseDuration;
     friend class PDPSimpleListener;
     public:
     /**
@@ -76,7 +84,7 @@ class PDPSimple
      * @param new_change If true a new change (with new seqNum) is created and sent; if false the last change is re-sent
      * @param dispose Sets change kind to NOT_ALIVE_DISPOSED_UNREGISTERED
      */
-    void announceParticipantState(bool new_change, bool dispose = false);
+    virtual void announceParticipantState(bool new_change, bool dispose = false);
     //!Stop the RTPSParticipantAnnouncement (only used in tests).
     void stopParticipantAnnouncement();
     //!Reset the RTPSParticipantAnnouncement (only used in tests).
@@ -132,6 +140,22 @@ class PDPSimple
      */
     bool removeWriterProxyData(const GUID_t& writer_guid);
 
+    /**
+     * Get the ReaderProxyData objects of all the registered RTPSParticipants (including the local RTPSParticipant)
+     * in a topic. Should be called with the mutex locked.
+     * @param topic_name Name of the topic.
+     * @return Reference to the readers in the topic, valid while the mutex is locked.
+     */
+    const std::vector<ReaderProxyData*>& topic_readers(const std::string& topic_name) const;
+
+    /**
+     * Get the WriterProxyData objects of all the registered RTPSParticipants (including the local RTPSParticipant)
+     * in a topic. Should be called with the mutex locked.
+     * @param topic_name Name of the topic.
+     * @return Reference to the writers in the topic, valid while the mutex is locked.
+     */
+    const std::vector<WriterProxyData*>& topic_writers(const std::string& topic_name) const;
+
     /**
      * This method assigns remtoe endpoints to the builtin endpoints defined in this protocol. It also calls the corresponding methods in EDP and WLP.
      * @param pdata Pointer to the RTPSParticipantProxyData object.
@@ -203,8 +227,57 @@ class PDPSimple
      */
     inline std::recursive_mutex* getMutex() const {return mp_mutex;}
 
+    /**
+     * Get the local ParticipantProxyData serialized, without encapsulation.
+     * The serialization is cached until the local data is announced as changed.
+     * @param endian Endianness of the serialization.
+     * @return Copy of the serialized data, empty on error.
+     */
     CDRMessage_t get_participant_proxy_data_serialized(Endianness_t endian);
 
+    protected:
+
+    /**
+     * Called when the SPDP data of a remote RTPSParticipant is received, with the mutex locked.
+     * @param pdata Registered data of the RTPSParticipant.
+     * @param sequence_number Sequence number of the received SPDP data.
+     */
+    virtual void remoteParticipantDataReceived(ParticipantProxyData* /*pdata*/,
+            const SequenceNumber_t& /*sequence_number*/) {}
+
+    /**
+     * Called when a new ReaderProxyData is registered, with the mutex locked.
+     * @param rdata Pointer to the registered ReaderProxyData.
+     */
+    virtual void readerProxyDataAdded(ReaderProxyData* /*rdata*/) {}
+
+    /**
+     * Called when a new WriterProxyData is registered, with the mutex locked.
+     * @param wdata Pointer to the registered WriterProxyData.
+     */
+    virtual void writerProxyDataAdded(WriterProxyData* /*wdata*/) {}
+
+    /**
+     * Called when a remote RTPSParticipant is unregistered, with the mutex locked.
+     * @param pdata Pointer to the data of the RTPSParticipant, deleted after the call.
+     */
+    virtual void participantProxyDataRemoved(ParticipantProxyData* /*pdata*/) {}
+
+    //!Finds a registered RTPSParticipant by GUID prefix. Should be called with the mutex or the registry mutex locked.
+    ParticipantProxyData* findParticipantProxy(const GuidPrefix_t& guidP) const;
+
+#if HAVE_CXX14
+    //!Lookups only read the registry, so they share its mutex.
+    typedef std::shared_timed_mutex RegistryMutex;
+    typedef std::shared_lock<RegistryMutex> RegistrySharedLock;
+#else
+    typedef std::mutex RegistryMutex;
+    typedef std::unique_lock<RegistryMutex> RegistrySharedLock;
+#endif
+
+    //!Get a pointer to the SPDPWriter.
+    StatelessWriter* getSPDPWriter() const { return mp_SPDPWriter; }
+
     private:
     //!Pointer to the local RTPSParticipant.
     RTPSParticipantImpl* mp_RTPSParticipant;
@@ -218,8 +291,28 @@ class PDPSimple
     EDP* mp_EDP;
     //!Registered RTPSParticipants (including the local one, that is the first one.)
     std::vector<ParticipantProxyData*> m_participantProxies;
+    //!ReaderProxyData objects of the registered RTPSParticipants, indexed by topic name.
+    std::unordered_map<std::string, std::vector<ReaderProxyData*>> m_topicReaders;
+    //!WriterProxyData objects of the registered RTPSParticipants, indexed by topic name.
+    std::unordered_map<std::string, std::vector<WriterProxyData*>> m_topicWriters;
+    //!Registered RTPSParticipants, indexed by GUID prefix.
+    std::unordered_map<GuidPrefix_t, ParticipantProxyData*, GuidPrefixHash> m_participantsByPrefix;
+    //!ReaderProxyData objects of the registered RTPSParticipants, indexed by GUID.
+    std::unordered_map<GUID_t, ReaderProxyData*, GUIDHash> m_readersByGuid;
+    //!WriterProxyData objects of the registered RTPSParticipants, indexed by GUID.
+    std::unordered_map<GUID_t, WriterProxyData*, GUIDHash> m_writersByGuid;
+    /**
+     * Protects the GUID indexes and the contents of the proxies in them, so lookups only need this mutex.
+     * They are modified with both mutexes locked, always taking the PDP mutex first, so they can be searched
+     * with any of them locked. Proxies are deleted after being removed from the indexes.
+     * It also protects the lease duration timers of the registered participants, which are detached from their
+     * proxies with it locked before being destroyed.
+     */
+    mutable RegistryMutex m_registryMutex;
     //!Variable to indicate if any parameter has changed.
     std::atomic_bool m_hasChangedLocalPDP;
+    //!Cached serialization of the local ParticipantProxyData. Empty when invalidated. Protected by mp_mutex.
+    CDRMessage_t m_localParticipantSerialized;
     //!TimedEvent to periodically resend the local RTPSParticipant information.
     ResendParticipantProxyDataPeriod* mp_resendParticipantTimer;
     //!Listener for the SPDP messages.
@@ -236,7 +329,11 @@ class PDPSimple
     bool createSPDPEndpoints();
     std::recursive_mutex* mp_mutex;
 
+    //!Adds a RTPSParticipant to the GUID indexes. Should be called with the mutex locked.
+    void registerParticipantProxy(ParticipantProxyData* pdata);
 
+    //!Removes a RTPSParticipant and its endpoints from the GUID indexes. Should be called with both mutexes locked.
+    void unregisterParticipantProxy(ParticipantProxyData* pdata);
 
 };
 
@@ -22,6 +22,7 @@
 #include "Types.h"
 #include "WriteParams.h"
 #include "SerializedPayload.h"
+#include "SharedPayload.h"
 #include "Time_t.h"
 #include "InstanceHandle.h"
 #include <fastrtps/rtps/common/FragmentNumber.h>
@@ -88,7 +89,10 @@ namespace eprosima
                     isRead(false),
                     is_untyped_(true),
                     dataFragments_(new std::vector<uint32_t>()),
-                    fragment_size_(0)
+                    fragment_size_(0),
+                    shared_payload_(nullptr),
+                    own_payload_data_(nullptr),
+                    own_payload_max_size_(0)
                 {
                 }
 
@@ -109,7 +113,10 @@ namespace eprosima
                     isRead(false),
                     is_untyped_(is_untyped),
                     dataFragments_(new std::vector<uint32_t>()),
-                    fragment_size_(0)
+                    fragment_size_(0),
+                    shared_payload_(nullptr),
+                    own_payload_data_(nullptr),
+                    own_payload_max_size_(0)
                 {
                 }
 
@@ -120,6 +127,8 @@ namespace eprosima
                  */
                 bool copy(const CacheChange_t* ch_ptr)
                 {
+                    release_shared_payload();
+
                     kind = ch_ptr->kind;
                     writerGUID = ch_ptr->writerGUID;
                     instanceHandle = ch_ptr->instanceHandle;
@@ -155,8 +164,70 @@ namespace eprosima
                     isRead = ch_ptr->isRead;
                 }
 
+                /*!
+                 * Moves the payload of this change to a SharedPayload, so other changes can reference it through
+                 * copy_shared() instead of copying it.
+                 * The data of the payload should not be modified while it is shared.
+                 * @return True if correct. On failure the change keeps its payload unshared.
+                 */
+                bool make_shared_payload()
+                {
+                    if (shared_payload_ != nullptr)
+                    {
+                        return true;
+                    }
+
+                    SharedPayload* shared = nullptr;
+                    try
+                    {
+                        shared = new SharedPayload(serializedPayload);
+                    }
+                    catch (std::bad_alloc&)
+                    {
+                        return false;
+                    }
+
+                    reference_payload(shared);
+                    return true;
+                }
+
+                /*!
+                 * Copy a different change into this one. The elements are copied as in copy_not_memcpy(), and the
+                 * payload is referenced instead of copied.
+                 * @param[in] ch_ptr Pointer to the change. Its payload should be shared (see make_shared_payload()).
+                 */
+                void copy_shared(const CacheChange_t* ch_ptr)
+                {
+                    copy_not_memcpy(ch_ptr);
+                    reference_payload(ch_ptr->shared_payload_);
+                }
+
+                //! Whether the payload of this change is a SharedPayload.
+                bool has_shared_payload() const { return shared_payload_ != nullptr; }
+
+                /*!
+                 * Stops referencing the SharedPayload, getting back the payload buffer the change had before sharing
+                 * it. The length of the payload is reset.
+                 */
+                void release_shared_payload()
+                {
+                    if (shared_payload_ != nullptr)
+                    {
+                        serializedPayload.data = own_payload_data_;
+                        serializedPayload.max_size = own_payload_max_size_;
+                        serializedPayload.length = 0;
+                        serializedPayload.pos = 0;
+                        own_payload_data_ = nullptr;
+                        own_payload_max_size_ = 0;
+                        shared_payload_->release();
+                        shared_payload_ = nullptr;
+                    }
+                }
+
                 ~CacheChange_t()
                 {
+                    release_shared_payload();
+
                     if (dataFragments_)
                         delete dataFragments_;
                 }
@@ -194,6 +265,28 @@ namespace eprosima
 
                 // Fragment size
                 uint16_t fragment_size_;
+
+                void reference_payload(SharedPayload* shared)
+                {
+                    release_shared_payload();
+
+                    shared->acquire();
+                    shared_payload_ = shared;
+                    own_payload_data_ = serializedPayload.data;
+                    own_payload_max_size_ = serializedPayload.max_size;
+                    serializedPayload.data = shared->payload.data;
+                    serializedPayload.max_size = shared->payload.length;
+                    serializedPayload.length = shared->payload.length;
+                    serializedPayload.encapsulation = shared->payload.encapsulation;
+                    serializedPayload.pos = 0;
+                }
+
+                // Payload referenced instead of owned
+                SharedPayload* shared_payload_;
+
+                // Payload buffer owned by the change while it references a shared one
+                octet* own_payload_data_;
+                uint32_t own_payload_max_size_;
             };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
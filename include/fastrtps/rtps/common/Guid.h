@@ -475,6 +475,58 @@ inline std::ostream& operator<<(std::ostream& output,const GUID_t& guid)
     return output;
 }
 
+/*!
+ * @brief Defines the STL hash function for type EntityId_t.
+ */
+struct EntityIdHash
+{
+    std::size_t operator()(const EntityId_t& entity_id) const noexcept
+    {
+        return (static_cast<std::size_t>(entity_id.value[0]) << 24) |
+            (static_cast<std::size_t>(entity_id.value[1]) << 16) |
+            (static_cast<std::size_t>(entity_id.value[2]) << 8) |
+            static_cast<std::size_t>(entity_id.value[3]);
+    }
+};
+
+/*!
+ * @brief Defines the STL hash function for type GuidPrefix_t.
+ */
+struct GuidPrefixHash
+{
+    std::size_t operator()(const GuidPrefix_t& prefix) const noexcept
+    {
+        // FNV-1a over the 12 octets of the prefix.
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < 12; ++i)
+        {
+            hash = (hash ^ prefix.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+/*!
+ * @brief Defines the STL hash function for type GUID_t.
+ */
+struct GUIDHash
+{
+    std::size_t operator()(const GUID_t& guid) const noexcept
+    {
+        // FNV-1a over the 16 octets of the GUID.
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < 12; ++i)
+        {
+            hash = (hash ^ guid.guidPrefix.value[i]) * 16777619u;
+        }
+        for(uint8_t i = 0; i < 4; ++i)
+        {
+            hash = (hash ^ guid.entityId.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
 #endif
 
 }
@@ -151,6 +151,23 @@ inline bool operator<(const InstanceHandle_t& h1, const InstanceHandle_t& h2)
     return memcmp(h1.value, h2.value, 16) < 0;
 }
 
+/*!
+ * @brief Defines the STL hash function for type InstanceHandle_t.
+ */
+struct InstanceHandleHash
+{
+    std::size_t operator()(const InstanceHandle_t& handle) const noexcept
+    {
+        // FNV-1a over the 16 octets of the handle.
+        uint32_t hash = 2166136261u;
+        for(uint8_t i = 0; i < 16; ++i)
+        {
+            hash = (hash ^ handle.value[i]) * 16777619u;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 /**
@@ -0,0 +1,65 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.h
+ */
+
+#ifndef NETWORK_BUFFER_H_
+#define NETWORK_BUFFER_H_
+
+#include "Types.h"
+
+#include <vector>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+/**
+ * Structure NetworkBuffer, a non-owning reference to a slice of memory that is part of an outgoing message.
+ * A message can be described by a list of these slices, which transports send in order as a single message
+ * without gathering them into one buffer first.
+ * @ingroup COMMON_MODULE
+ */
+struct NetworkBuffer
+{
+    NetworkBuffer()
+        : buffer(nullptr)
+        , size(0)
+    {
+    }
+
+    NetworkBuffer(
+            const octet* buf,
+            uint32_t len)
+        : buffer(buf)
+        , size(len)
+    {
+    }
+
+    //!Pointer to the first byte of the slice.
+    const octet* buffer;
+    //!Number of bytes of the slice.
+    uint32_t size;
+};
+
+//!Ordered list of slices that compose an outgoing message.
+typedef std::vector<NetworkBuffer> NetworkBufferList;
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* NETWORK_BUFFER_H_ */
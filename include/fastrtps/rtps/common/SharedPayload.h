@@ -0,0 +1,88 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedPayload.h
+ */
+
+#ifndef SHAREDPAYLOAD_H_
+#define SHAREDPAYLOAD_H_
+
+#include "SerializedPayload.h"
+
+#include <atomic>
+
+namespace eprosima{
+    namespace fastrtps{
+        namespace rtps{
+
+            /**
+             * Reference counted serialized payload.
+             * Several CacheChange_t, possibly belonging to different histories, can reference it instead of keeping
+             * their own copy of the data. It is destroyed when the last reference is released.
+             * @ingroup COMMON_MODULE
+             */
+            class SharedPayload
+            {
+                public:
+
+                    /**
+                     * Creates a copy of a payload without references.
+                     * @param source Payload to be copied.
+                     * @throw std::bad_alloc if the data cannot be allocated.
+                     */
+                    explicit SharedPayload(const SerializedPayload_t& source)
+                        : references_(0)
+                    {
+                        payload.copy(&source, false);
+                    }
+
+                    SharedPayload(const SharedPayload&) = delete;
+                    SharedPayload& operator=(const SharedPayload&) = delete;
+
+                    //! Adds a reference.
+                    void acquire()
+                    {
+                        references_.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    //! Removes a reference, destroying the object when it was the last one.
+                    void release()
+                    {
+                        if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        {
+                            delete this;
+                        }
+                    }
+
+                    //! Number of references.
+                    uint32_t references() const
+                    {
+                        return references_.load(std::memory_order_relaxed);
+                    }
+
+                    //! Shared data. Should not be modified while referenced by several changes.
+                    SerializedPayload_t payload;
+
+                private:
+
+                    ~SharedPayload() = default;
+
+                    std::atomic<uint32_t> references_;
+            };
+        }
+    }
+}
+
+#endif /* SHAREDPAYLOAD_H_ */
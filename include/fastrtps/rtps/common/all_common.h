@@ -30,6 +30,7 @@
 #include "Time_t.h"
 #include "CacheChange.h"
 #include "MatchingInfo.h"
+#include "NetworkBuffer.h"
 
 
 #endif /* FASTRTPS_ALL_COMMON_H_ */
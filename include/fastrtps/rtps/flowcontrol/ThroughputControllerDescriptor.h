@@ -33,6 +33,16 @@ struct ThroughputControllerDescriptor
     uint32_t bytesPerPeriod;
     //! Window of time in which no more than 'bytesPerPeriod' bytes are allowed.
     uint32_t periodMillisecs;
+    /**
+     * Bytes that can be sent at once after the controller has been idle. Values lower than 'bytesPerPeriod'
+     * (like the default zero) are taken as 'bytesPerPeriod'.
+     */
+    uint32_t burstSize;
+    /**
+     * Priority of the writer on controllers shared with other writers, like the participant one. While a writer is
+     * waiting for the controller, writers with lower priority are held back. Default value: 0.
+     */
+    int32_t priority;
 
     RTPS_DllAPI ThroughputControllerDescriptor();
     RTPS_DllAPI ThroughputControllerDescriptor(uint32_t size, uint32_t time);
@@ -40,7 +50,9 @@ struct ThroughputControllerDescriptor
     bool operator==(const ThroughputControllerDescriptor& b) const
     {
         return (this->bytesPerPeriod == b.bytesPerPeriod) &&
-               (this->periodMillisecs == b.periodMillisecs);
+               (this->periodMillisecs == b.periodMillisecs) &&
+               (this->burstSize == b.burstSize) &&
+               (this->priority == b.priority);
     }
 };
 
@@ -23,6 +23,7 @@
 #define CACHECHANGEPOOL_H_
 
 #include "../resources/ResourceManagement.h"
+#include "../common/Types.h"
 
 #include <vector>
 #include <functional>
@@ -57,8 +58,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param calculateSizeFunc Function that returns the size of the data which will go into the CacheChange.
-         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE and
-         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
+         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE,
+         * DYNAMIC_REUSABLE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, const std::function<uint32_t()>& calculateSizeFunc);
@@ -67,7 +68,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param dataSize Size of the data which will go into the CacheChange if it is necessary (on memory management
-         * policy DYNAMIC_RESERVE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE). In other case this variable is not used.
+         * policy DYNAMIC_RESERVE_MEMORY_MODE, DYNAMIC_REUSABLE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE).
+         * In other case this variable is not used.
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, uint32_t dataSize);
@@ -89,7 +91,21 @@ class CacheChangePool {
         std::vector<CacheChange_t*> m_allCaches;
         bool allocateGroup(uint32_t pool_size);
         CacheChange_t* allocateSingle(uint32_t dataSize);
+        bool reservePayload(CacheChange_t* ch, uint32_t dataSize);
+        void releasePayload(CacheChange_t* ch);
         MemoryManagementPolicy_t memoryMode;
+
+        //! Payload buffer kept for reuse on DYNAMIC_REUSABLE_MEMORY_MODE.
+        struct FreePayload
+        {
+            octet* data;
+            uint32_t max_size;
+        };
+
+        //! Cache-line aligned blocks where the CacheChanges are constructed on DYNAMIC_REUSABLE_MEMORY_MODE.
+        std::vector<void*> m_changeBlocks;
+        //! Released payload buffers on DYNAMIC_REUSABLE_MEMORY_MODE. Buffers in position i hold at least 2^i bytes.
+        std::vector<std::vector<FreePayload>> m_freePayloads;
 };
 }
 } /* namespace rtps */
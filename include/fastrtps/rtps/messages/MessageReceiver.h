@@ -26,6 +26,12 @@
 #include <fastrtps/rtps/writer/StatelessWriter.h>
 #include <fastrtps/rtps/writer/StatefulWriter.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 
 namespace eprosima {
 namespace fastrtps{
@@ -73,12 +79,113 @@ class MessageReceiver
 #endif
         // Functions to associate/remove associatedendpoints
         void associateEndpoint(Endpoint *to_add);
+        /**
+         * Remove an associated endpoint.
+         * When this method returns, no message being processed by this receiver is using the endpoint.
+         * @param to_remove Pointer to the endpoint.
+         */
         void removeEndpoint(Endpoint *to_remove);
 
+        /**
+         * Notify that an associated reader has matched a remote writer.
+         * Messages from that writer directed to ENTITYID_UNKNOWN will be delivered to the reader.
+         * @param reader Pointer to the reader.
+         * @param writer_guid GUID of the matched writer.
+         */
+        void matchedWriterAdded(RTPSReader* reader, const GUID_t& writer_guid);
+
+        /**
+         * Notify that an associated reader has unmatched a remote writer.
+         * @param reader Pointer to the reader.
+         * @param writer_guid GUID of the unmatched writer.
+         */
+        void matchedWriterRemoved(RTPSReader* reader, const GUID_t& writer_guid);
+
+        /**
+         * Notify that an associated reader stopped accepting messages from writers it has not matched.
+         * @param reader Pointer to the reader.
+         */
+        void readerFilterChanged(RTPSReader* reader);
+
     private:
-        std::vector<RTPSWriter *> AssociatedWriters;
-        std::vector<RTPSReader *> AssociatedReaders;
-        std::mutex mtx;
+        typedef std::vector<RTPSReader *> ReaderVector;
+
+        //!Endpoints associated to this receiver, indexed for the dispatch of submessages.
+        struct AssociatedEndpoints
+        {
+            std::vector<RTPSWriter *> writers;
+            ReaderVector readers;
+            //!Writers indexed by their entityId.
+            std::unordered_map<EntityId_t, RTPSWriter *, EntityIdHash> writers_by_id;
+            //!Readers indexed by their entityId.
+            std::unordered_map<EntityId_t, RTPSReader *, EntityIdHash> readers_by_id;
+            //!Readers that accept messages from any writer with a given entityId, indexed by that entityId.
+            std::unordered_map<EntityId_t, ReaderVector, EntityIdHash> readers_by_trusted_writer;
+            //!Readers that accept messages from any writer.
+            ReaderVector readers_from_any_writer;
+            /**
+             * Readers that only accept messages from their matched writers, indexed by the writer GUID.
+             * Lists are shared between tables, so matching a writer only copies the readers of that writer.
+             */
+            std::unordered_map<GUID_t, std::shared_ptr<const ReaderVector>, GUIDHash> readers_by_writer;
+        };
+
+        /**
+         * Call a functor for every associated reader a submessage should be delivered to.
+         * @param endpoints Table of associated endpoints.
+         * @param readerID EntityId the submessage is directed to.
+         * @param writerGUID GUID of the writer sending the submessage.
+         * @param callback Functor called with each reader.
+         */
+        template<typename Functor>
+        void findAllReaders(const AssociatedEndpoints& endpoints, const EntityId_t& readerID,
+                const GUID_t& writerGUID, const Functor& callback) const;
+
+        /**
+         * Publish a modified copy of the table of associated endpoints.
+         * Must be called with endpoints_mutex_ locked.
+         * @param modifier Functor that modifies the copy. Returns false when no change is needed.
+         * @return The previous table, or nullptr if it was not replaced.
+         */
+        template<typename Functor>
+        std::shared_ptr<const AssociatedEndpoints> updateEndpoints(const Functor& modifier);
+
+        /**
+         * Remove a reader from the readers accepting messages from any writer.
+         * Must be called with endpoints_mutex_ locked.
+         * @param reader Pointer to the reader.
+         */
+        void removeReaderFromAnyWriter(RTPSReader* reader);
+
+
+        //!Keeps a message registered as being dispatched while in scope.
+        class DispatchGuard;
+
+        /**
+         * Wait until every message that started being dispatched before the call finishes.
+         * Must be called without endpoints_mutex_ locked.
+         */
+        void waitForDispatches();
+        //!Current table of associated endpoints. Never modified once published, so it is read without locking.
+        std::shared_ptr<const AssociatedEndpoints> associated_endpoints_;
+        //!Serializes modifications of the associated endpoints.
+        std::mutex endpoints_mutex_;
+        //!Readers a DATA submessage is delivered to. Reused between messages to avoid allocations.
+        ReaderVector data_readers_;
+        /**
+         * Messages being dispatched, for each parity of dispatch_epoch_.
+         * A message registers before loading the table of associated endpoints, so the ones registered with the
+         * previous parity are the only ones that may be using a table replaced before increasing the epoch.
+         */
+        std::atomic<uint32_t> active_dispatches_[2];
+        //!Increased by waitForDispatches.
+        std::atomic<uint32_t> dispatch_epoch_;
+        //!Whether waitForDispatches is waiting, so finishing messages notify it.
+        std::atomic<bool> dispatch_waiting_;
+        //!Serializes calls to waitForDispatches.
+        std::mutex dispatch_wait_mutex_;
+        std::mutex dispatch_mutex_;
+        std::condition_variable dispatch_cond_;
         //!Protocol version of the message
         ProtocolVersion_t sourceVersion;
         //!VendorID that created the message
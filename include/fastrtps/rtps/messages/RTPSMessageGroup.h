@@ -24,6 +24,7 @@
 #include "../messages/RTPSMessageCreator.h"
 #include "../../qos/ParameterList.h"
 #include <fastrtps/rtps/common/FragmentNumber.h>
+#include <fastrtps/rtps/common/NetworkBuffer.h>
 
 #include <vector>
 #include <chrono>
@@ -62,6 +63,12 @@ class RTPSMessageGroup_t
 #if HAVE_SECURITY
         CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+        //! Payloads referenced (not copied) by rtpsmsg_fullmsg_, with the position where each one is inserted.
+        std::vector<std::pair<uint32_t, NetworkBuffer>> rtpsmsg_payloads_;
+
+        //! Gather list used to send rtpsmsg_fullmsg_ together with the referenced payloads.
+        NetworkBufferList rtpsmsg_buffers_;
 };
 
 class RTPSWriter;
@@ -223,7 +230,13 @@ class RTPSMessageGroup
                 int32_t count,
                 const LocatorList_t locators);
 
-        uint32_t get_current_bytes_processed() { return currentBytesSent_ + full_msg_->length; }
+        /**
+         * Changes the endpoint of the submessages added from now on, so several endpoints can share the messages.
+         * @param endpoint Pointer to the endpoint sending data.
+         */
+        void set_endpoint(Endpoint* endpoint);
+
+        uint32_t get_current_bytes_processed() { return currentBytesSent_ + full_msg_->length + referenced_bytes_; }
 
     private:
 
@@ -244,6 +257,13 @@ class RTPSMessageGroup
 
         bool insert_submessage(const std::vector<GUID_t>& remote_endpoints);
 
+        bool insert_submessage(const std::vector<GUID_t>& remote_endpoints,
+                const NetworkBuffer& payload, uint32_t payload_position);
+
+        bool append_submessage(const NetworkBuffer& payload, uint32_t payload_position);
+
+        bool can_reference_payload() const;
+
         bool add_info_dst_in_buffer(CDRMessage_t* buffer, const std::vector<GUID_t>& remote_endpoints);
 
         bool add_info_ts_in_buffer(const std::vector<GUID_t>& remote_readers, const Time_t& timestamp);
@@ -256,6 +276,13 @@ class RTPSMessageGroup
 
         CDRMessage_t* submessage_msg_;
 
+        std::vector<std::pair<uint32_t, NetworkBuffer>>* payloads_;
+
+        NetworkBufferList* buffers_;
+
+        //! Bytes of the message that live in referenced payloads instead of full_msg_.
+        uint32_t referenced_bytes_;
+
         uint32_t currentBytesSent_;
 
         LocatorList_t current_locators_;
@@ -50,6 +50,17 @@ public:
     virtual void OnDataReceived(const octet* data, const uint32_t size,
         const Locator_t& localLocator, const Locator_t& remoteLocator) override;
 
+    /**
+    * Method called by the transport when a batch of messages was received in a single operation.
+    * The whole batch is processed by the registered MessageReceiver while holding the lock once.
+    * @param messages Array of received messages.
+    * @param remote_locators Array with the locator identifying the remote endpoint of each message.
+    * @param count Number of messages in both arrays.
+    * @param localLocator Locator identifying the local endpoint.
+    */
+    virtual void OnDataBatchReceived(const CDRMessage_t* messages, const Locator_t* remote_locators,
+        uint32_t count, const Locator_t& localLocator) override;
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
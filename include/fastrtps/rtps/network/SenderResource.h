@@ -15,6 +15,10 @@
 #ifndef SENDER_RESOURCE_H
 #define SENDER_RESOURCE_H
 
+#include "../common/Locator.h"
+#include "../common/NetworkBuffer.h"
+
+#include <cstring>
 #include <functional>
 #include <vector>
 
@@ -26,7 +30,6 @@ class RTPSParticipantImpl;
 class MessageReceiver;
 class ChannelResource;
 class TransportInterface;
-class Locator_t;
 
 /**
  * RAII object that encapsulates the Send operation over one chanel in an unknown transport.
@@ -59,6 +62,55 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends a message, described as an ordered list of buffers, to several destination locators through
+     * the channel managed by this resource.
+     * Transports supporting it send the buffers without gathering them first, and hand all the destinations
+     * to the operating system in as few operations as possible. Otherwise the buffers are gathered once and
+     * sent to each destination locator.
+     * @param buffers Ordered list of buffers composing the message.
+     * @param total_bytes Sum of the sizes of all buffers.
+     * @param destination_locators List of locators describing the destination endpoints.
+     * @return Success of the send operation.
+     */
+    bool send(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            const LocatorList_t& destination_locators)
+    {
+        if (send_buffers_lambda_)
+        {
+            return send_buffers_lambda_(buffers, total_bytes, destination_locators);
+        }
+
+        const octet* data = nullptr;
+
+        if (buffers.size() == 1)
+        {
+            data = buffers[0].buffer;
+        }
+        else
+        {
+            gather_buffer_.resize(total_bytes);
+            uint32_t offset = 0;
+            for (const NetworkBuffer& buffer : buffers)
+            {
+                memcpy(&gather_buffer_[offset], buffer.buffer, buffer.size);
+                offset += buffer.size;
+            }
+            data = gather_buffer_.data();
+        }
+
+        bool returned_value = false;
+
+        for (const Locator_t& destination_locator : destination_locators)
+        {
+            returned_value |= send(data, total_bytes, destination_locator);
+        }
+
+        return returned_value;
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -67,6 +119,7 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
     }
 
     virtual ~SenderResource() = default;
@@ -81,9 +134,14 @@ protected:
 
     std::function<void()> clean_up;
     std::function<bool(const octet*, uint32_t, const Locator_t&)> send_lambda_;
+    //! Optional. Transports that can send gather lists to several destinations at once should set it.
+    std::function<bool(const NetworkBufferList&, uint32_t, const LocatorList_t&)> send_buffers_lambda_;
 
 private:
 
+    //! Used to gather a message when the transport does not support gather lists.
+    std::vector<octet> gather_buffer_;
+
     SenderResource()                                 = delete;
     SenderResource(const SenderResource&)            = delete;
     SenderResource& operator=(const SenderResource&) = delete;
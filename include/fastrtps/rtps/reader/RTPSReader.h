@@ -229,11 +229,32 @@ public:
     */
     virtual bool isInCleanState() = 0;
 
+    /*!
+     * @brief Get the state of a matched writer as this reader would acknowledge it on an ACKNACK message.
+     * Writers living in the same process use it to update their acknowledgement state directly.
+     * @param writer_guid GUID of the writer.
+     * @param[out] ack_base First sequence number of the writer not received yet.
+     * @return True if the reader keeps the state of the writer.
+     */
+    virtual bool get_acknack_base(
+            const GUID_t& writer_guid,
+            SequenceNumber_t& ack_base)
+    {
+        (void)writer_guid; (void)ack_base;
+        return false;
+    }
+
     //! The liveliness changed status struct as defined in the DDS
     LivelinessChangedStatus liveliness_changed_status_;
 
 protected:
 
+    /**
+     * Tells whether this reader accepts messages from writers it has not matched.
+     * @return True when messages from unknown writers are accepted.
+     */
+    virtual bool acceptMsgFromUnknownWriters() const { return m_acceptMessagesFromUnkownWriters; }
+
     void setTrustedWriter(EntityId_t writer)
     {
         m_acceptMessagesFromUnkownWriters=false;
@@ -28,6 +28,8 @@ namespace fastrtps{
 namespace rtps {
 
 class WriterProxy;
+class AckNackCoalescingDelay;
+class RTPSMessageGroup_t;
 
 /**
  * Class StatefulReader, specialization of RTPSReader than stores the state of the matched writers.
@@ -189,11 +191,41 @@ class StatefulReader:public RTPSReader
          */
         bool isInCleanState() override;
 
+        /*!
+         * @brief Get the state of a matched writer as this reader would acknowledge it on an ACKNACK message.
+         * @param writer_guid GUID of the writer.
+         * @param[out] ack_base First sequence number of the writer not received yet.
+         * @return True if the writer is matched.
+         */
+        bool get_acknack_base(
+                const GUID_t& writer_guid,
+                SequenceNumber_t& ack_base) override;
+
+        /*!
+         * @brief Holds the response to a heartbeat of a matched writer until the acknack coalescing window
+         * expires, so it is sent on the same message as the responses to other writers on the same locators.
+         * Should be called with the mutex locked.
+         * @param wp Writer proxy of the writer whose heartbeat is answered.
+         * @return False if acknack coalescing is disabled and the response has to be sent right away.
+         */
+        bool delay_acknack(WriterProxy* wp);
+
+        /*!
+         * @brief Sends the responses held by the acknack coalescing window.
+         * @param buffers Buffers used to build the messages.
+         */
+        void send_delayed_acknacks(RTPSMessageGroup_t& buffers);
+
         //! Acknack Count
         uint32_t m_acknackCount;
         //! NACKFRAG Count
         uint32_t m_nackfragCount;
 
+    protected:
+
+        //! Only messages from matched writers are accepted, regardless of m_acceptMessagesFromUnkownWriters.
+        bool acceptMsgFromUnknownWriters() const override { return false; }
+
     private:
 
         bool acceptMsgFrom(GUID_t &entityGUID ,WriterProxy **wp);
@@ -211,6 +243,10 @@ class StatefulReader:public RTPSReader
         std::vector<WriterProxy*> matched_writers;
         //! True to disable positive ACKs
         bool disable_positive_acks_;
+        //! Event sending the delayed responses to heartbeats, only when acknacks are coalesced.
+        AckNackCoalescingDelay* acknack_coalescing_;
+        //! Writers whose responses wait for the acknack coalescing window to expire.
+        std::vector<WriterProxy*> pending_acknacks_;
 };
 
 }
@@ -26,8 +26,7 @@
 #include "../common/Locator.h"
 #include "../common/CacheChange.h"
 #include "../attributes/ReaderAttributes.h"
-
-#include<set>
+#include "../../utils/collections/RingBuffer.hpp"
 
 // Testing purpose
 #ifndef TEST_FRIENDS
@@ -167,29 +166,56 @@ namespace eprosima
 
                     void cleanup();
 
+                    /*!
+                     * @brief Add a ChangeFromWriter_t at the end of the m_changesFromW container.
+                     * Its sequence number must be the next one after the last element.
+                     * @remarks No thread-safe.
+                     */
+                    void add_change_nts(const ChangeFromWriter_t& change);
+
+                    /*!
+                     * @brief Remove the first ChangeFromWriter_t of the m_changesFromW container,
+                     * moving changesFromWLowMark_ to its sequence number.
+                     * @remarks No thread-safe.
+                     */
+                    void remove_first_change_nts();
+
+                    /*!
+                     * @brief Find the ChangeFromWriter_t of a sequence number.
+                     * @param seq_num Sequence number to look for.
+                     * @return Pointer to the element in the m_changesFromW container, or nullptr if it is not there.
+                     * @remarks No thread-safe.
+                     */
+                    ChangeFromWriter_t* find_change_nts(const SequenceNumber_t& seq_num);
+
+                    /*!
+                     * @brief Change the status of the first elements of the m_changesFromW container.
+                     * @param count Number of elements to visit.
+                     * @param status Only elements with this status are changed.
+                     * @param new_status Status to set.
+                     * @remarks No thread-safe.
+                     */
+                    void set_status_nts(size_t count, ChangeFromWriterStatus_t status,
+                            ChangeFromWriterStatus_t new_status);
+
                     //Print Method for log purposes
                     void print_changes_fromWriter_test2();
 
                     //!Mutex Pointer
                     std::recursive_mutex* mp_mutex;
 
-                    //!Vector containing the ChangeFromWriter_t objects.
-                    std::set<ChangeFromWriter_t, ChangeFromWriterCmp> m_changesFromW;
+                    /*!
+                     * Ring containing the ChangeFromWriter_t objects.
+                     * It always holds the consecutive sequence numbers following changesFromWLowMark_.
+                     */
+                    RingBuffer<ChangeFromWriter_t> m_changesFromW;
                     SequenceNumber_t changesFromWLowMark_;
 
+                    //! Number of elements in m_changesFromW with status MISSING.
+                    size_t missing_changes_count_;
+
                     //! Store last ChacheChange_t notified.
                     SequenceNumber_t lastNotified_;
-
-                    void for_each_set_status_from(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
-                            ChangeFromWriterStatus_t status,
-                            ChangeFromWriterStatus_t new_status);
-
-                    void for_each_set_status_from_and_maybe_remove(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
-                            ChangeFromWriterStatus_t status,
-                            ChangeFromWriterStatus_t orstatus,
-                            ChangeFromWriterStatus_t new_status);
             };
 
         } /* namespace rtps */
@@ -0,0 +1,71 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AckNackCoalescingDelay.h
+ *
+ */
+
+#ifndef ACKNACKCOALESCINGDELAY_H_
+#define ACKNACKCOALESCINGDELAY_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#include "../../resources/TimedEvent.h"
+#include "../../messages/RTPSMessageGroup.h"
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+class StatefulReader;
+
+/**
+ * Class AckNackCoalescingDelay, TimedEvent used to send together the responses to the heartbeats
+ * received by a reader during the acknack coalescing window.
+ * @ingroup READER_MODULE
+ */
+class AckNackCoalescingDelay : public TimedEvent
+{
+    public:
+
+        virtual ~AckNackCoalescingDelay();
+
+        /**
+         * @param reader Reader whose responses are sent.
+         * @param interval Coalescing window in milliseconds.
+         */
+        AckNackCoalescingDelay(
+                StatefulReader* reader,
+                double interval);
+
+        /**
+         * Method invoked when the event occurs
+         *
+         * @param code Code representing the status of the event
+         * @param msg Message associated to the event
+         */
+        void event(
+                EventCode code,
+                const char* msg= nullptr);
+
+        //!Pointer to the StatefulReader associated with this specific event.
+        StatefulReader* mp_SFR;
+        //!CDRMessage_t used in the responses.
+        RTPSMessageGroup_t m_cdrmessages;
+};
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
+#endif
+#endif /* ACKNACKCOALESCINGDELAY_H_ */
@@ -58,6 +58,13 @@ class HeartbeatResponseDelay:public TimedEvent
                     EventCode code,
                     const char* msg= nullptr);
 
+            /**
+             * Adds the ACKNACK and NACKFRAG submessages answering the last heartbeat of the writer.
+             * Should be called with the mutex of the reader locked.
+             * @param group Message group where the submessages are added.
+             */
+            void add_response(RTPSMessageGroup& group);
+
             //!Pointer to the WriterProxy associated with this specific event.
             WriterProxy* mp_WP;
             //!CDRMessage_t used in the response.
@@ -16,47 +16,98 @@
 #define _RTPS_RESOURCES_ASYNC_INTEREST_TREE_H_
 
 #include <fastrtps/rtps/writer/RTPSWriter.h>
-#include <mutex>
-#include <set>
+#include <atomic>
+#include <thread>
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+/**
+ * List of writers interested in an asynchronous write.
+ *
+ * The list is intrusive: each writer holds its own link and a flag telling whether it is already in the list, so
+ * registering interest never allocates and takes a single atomic operation when the writer is already registered.
+ * Any thread can register interest, but only one thread at a time can take the interested writers.
+ */
 class AsyncInterestTree
 {
 public:
 
    AsyncInterestTree();
+
    /**
-    * Registers a writer in a hidden set.
-    * Threadsafe thanks to set swap.
+    * Registers a writer in the list. Lock-free.
+    * @return True if the writer was not already in the list.
     */
-   void RegisterInterest(const RTPSWriter*);
+   bool RegisterInterest(const RTPSWriter*);
 
    /**
-    * Registers all writers from  participant in a hidden set.
-    * Threadsafe thanks to set swap.
+    * Registers all writers from participant in the list.
+    * @return True if any of the writers was not already in the list.
     */
-   void RegisterInterest(const RTPSParticipantImpl*);
+   bool RegisterInterest(const RTPSParticipantImpl*);
 
    /**
-    * Clears the visible set and swaps
-    * with the hidden set.
+    * Empties the list, calling the functor with each of the writers in registration order.
+    * A writer can be registered again as soon as it is taken, even before the functor is called for it.
+    * @param functor Callable with signature void(const RTPSWriter*).
     */
-   void Swap();
+   template<typename Functor>
+   void TakeInterestedWriters(Functor functor);
 
-   //! Extracts from the visible set 
-   std::set<const RTPSWriter*> GetInterestedWriters() const;
+   /**
+    * Takes a writer out of the list for good. Its interest is ignored from then on, so it can be destroyed while
+    * other threads still try to register it.
+    * Must be called by the thread allowed to take the interested writers.
+    * @param writer Writer to remove.
+    * @param functor Called as in TakeInterestedWriters for the writers taken while removing it.
+    */
+   template<typename Functor>
+   void RemoveWriter(const RTPSWriter* writer, Functor functor);
 
 private:
-   std::set<const RTPSWriter*> mInterestAlpha, mInterestBeta;
-   mutable std::mutex mMutexActive, mMutexHidden;
-   
-   std::set<const RTPSWriter*>* mActiveInterest;
-   std::set<const RTPSWriter*>* mHiddenInterest;
+   //! Last registered writer. Writers are linked from the last one to the first one.
+   std::atomic<const RTPSWriter*> mHead;
 };
 
+template<typename Functor>
+void AsyncInterestTree::TakeInterestedWriters(Functor functor)
+{
+   const RTPSWriter* writer = mHead.exchange(nullptr, std::memory_order_acquire);
+
+   // Reverse the links, so writers are visited in registration order.
+   const RTPSWriter* first = nullptr;
+   while (writer != nullptr)
+   {
+      const RTPSWriter* next = writer->async_interest_next_;
+      writer->async_interest_next_ = first;
+      first = writer;
+      writer = next;
+   }
+
+   while (first != nullptr)
+   {
+      // Links must be read before the writer can be registered again.
+      writer = first;
+      first = writer->async_interest_next_;
+      writer->async_interest_registered_.store(false, std::memory_order_release);
+      functor(writer);
+   }
+}
+
+template<typename Functor>
+void AsyncInterestTree::RemoveWriter(const RTPSWriter* writer, Functor functor)
+{
+   // A writer flagged as registered is never linked again, so the flag is left set. If it was already set, the
+   // writer is in the list, or about to be linked by a concurrent registration, and has to be taken first.
+   while (writer->async_interest_registered_.exchange(true, std::memory_order_acq_rel))
+   {
+      TakeInterestedWriters(functor);
+      std::this_thread::yield();
+   }
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -20,10 +20,11 @@
 #define _RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 
 #include <thread>
-#include <atomic>
 #include <mutex>
 #include <condition_variable>
-#include <list>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 #include <fastrtps/rtps/resources/AsyncInterestTree.h>
 
@@ -31,18 +32,25 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 class RTPSWriter;
+class RTPSParticipantImpl;
 
 /**
- * @brief This static class owns a thread that manages asynchronous writes.
+ * @brief Pool of threads that manages the asynchronous writes of the writers of a participant.
  * Asynchronous writes happen directly (when using an async writer) and
  * indirectly (when responding to a NACK).
+ *
+ * Each writer is assigned to one of the threads of the pool, which serves it by default. Idle threads steal
+ * pending writers from busy ones, but a writer is never served by two threads at the same time, so its
+ * samples are sent in order.
+ *
+ * The static methods forward to the pool of the participant the writer belongs to.
  * @ingroup COMMON_MODULE
  */
 class AsyncWriterThread
 {
 public:
     /**
-     * @brief Adds a writer to be managed by this thread.
+     * @brief Adds a writer to be managed by the pool of its participant.
      * Only asynchronous writers are permitted.
      * @param writer Asynchronous writer to be added.
      * @return Result of the operation.
@@ -51,43 +59,103 @@ public:
 
     /**
      * @brief Removes a writer.
+     * Waits until the writer is not being served by any thread.
      * @param writer Asynchronous writer to be removed.
      * @return Result of the operation.
      */
     static bool removeWriter(RTPSWriter& writer);
 
     /**
-     * Wakes the thread up.
+     * Wakes the threads up.
      * @param interestedParticipant The participant interested in an async write.
      */
     static void wakeUp(const RTPSParticipantImpl* interestedParticipant);
 
     /**
-     * Wakes the thread up.
+     * Wakes the threads up.
      * @param interestedWriter The writer interested in an async write.
      */
     static void wakeUp(const RTPSWriter* interestedWriter);
 
+    /**
+     * Constructor. Threads are started when the first writer is added, and live until the pool is destroyed.
+     * @param thread_count Number of threads of the pool. Zero is taken as one.
+     */
+    explicit AsyncWriterThread(uint32_t thread_count);
+
+    ~AsyncWriterThread();
+
 private:
-    AsyncWriterThread() = delete;
-    ~AsyncWriterThread() = delete;
     AsyncWriterThread(const AsyncWriterThread&) = delete;
     const AsyncWriterThread& operator=(const AsyncWriterThread&) = delete;
 
-    //! @brief runs main method
-    static void run();
+    //! State of a writer managed by the pool.
+    struct WriterState
+    {
+        //! The writer.
+        RTPSWriter* writer;
+        //! Index of the thread serving this writer by default.
+        size_t thread;
+        //! Whether the writer is in the queue of its thread.
+        bool queued;
+        //! Whether a thread is sending on behalf of the writer.
+        bool running;
+        //! Whether the writer got interest while running, so it has to be queued again afterwards.
+        bool rerun;
+    };
+
+    bool add_writer(RTPSWriter& writer);
+
+    bool remove_writer(RTPSWriter& writer);
+
+    void wake_up();
+
+    //! @brief Main method of each thread of the pool.
+    void run(size_t index);
+
+    /**
+     * @brief Moves writers with registered interest to the queues of their threads. Requires mutex_.
+     * @return Number of writers scheduled.
+     */
+    size_t schedule_interested_writers();
+
+    //! @brief Schedules a writer taken from the interest list, if it is known. Requires mutex_.
+    bool schedule_interested_writer(const RTPSWriter* writer);
+
+    //! @brief Queues a writer unless it is already queued or running. Requires mutex_.
+    void schedule(WriterState& state);
+
+    //! @brief Takes the next writer for a thread, stealing from the other threads when idle. Requires mutex_.
+    WriterState* take_writer(size_t index);
+
+    //! Number of threads of the pool.
+    size_t thread_count_;
+
+    std::vector<std::thread> threads_;
+
+    //! Protects all the members below, never held while sending.
+    std::mutex mutex_;
+
+    //! Signaled when there is work for the threads.
+    std::condition_variable cv_;
+
+    //! Signaled when a thread finishes serving a writer.
+    std::condition_variable writer_done_cv_;
+
+    //! Asynchronous writers and their state.
+    std::unordered_map<const RTPSWriter*, WriterState> writers_;
+
+    //! Writers pending to be served, one queue per thread.
+    std::vector<std::deque<WriterState*>> queues_;
+
+    //! Next thread a new writer will be assigned to.
+    size_t next_thread_;
 
-    static std::thread* thread_;
-    static std::mutex data_structure_mutex_;
-    static std::mutex condition_variable_mutex_;
+    AsyncInterestTree interestTree;
 
-    //! List of asynchronous writers.
-    static std::list<RTPSWriter*> async_writers;
-    static AsyncInterestTree interestTree;
+    bool running_;
 
-    static bool running_;
-    static bool run_scheduled_;
-    static std::condition_variable cv_;
+    bool run_scheduled_;
 };
 
 } // namespace rtps
@@ -29,6 +29,7 @@ namespace fastrtps{
 namespace rtps {
 
 class RTPSParticipantImpl;
+class TimerWheel;
 
 /**
  * Class ResourceEvent used to manage the temporal events.
@@ -53,6 +54,12 @@ public:
 
     std::thread& getThread() { return *mp_b_thread; }
 
+    /**
+    * Get the timer wheel running on the thread of this resource
+    * @return Associated timer wheel
+    */
+    TimerWheel& get_timer_wheel() { return *mp_timer_wheel; }
+
 private:
 
 	//!Thread
@@ -61,6 +68,8 @@ private:
 	asio::io_service* mp_io_service;
 	//!
 	void * mp_work;
+	//!Timer wheel for the timed events, owned by the IO service
+	TimerWheel* mp_timer_wheel;
 
 	/**
 	 * Task to announce the correctness of the thread.
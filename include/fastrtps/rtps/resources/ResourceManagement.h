@@ -32,7 +32,8 @@ namespace rtps{
 typedef enum MemoryManagementPolicy{
     PREALLOCATED_MEMORY_MODE, //!< Preallocated memory. Size set to the data type maximum. Largest memory footprint but smalles allocation count.
     PREALLOCATED_WITH_REALLOC_MEMORY_MODE, //!< Default size preallocated, requires reallocation when a bigger message arrives. Smaller memory footprint at the cost of an increased allocation count.
-    DYNAMIC_RESERVE_MEMORY_MODE //< Dynamic allocation at the time of message arrival. Least memory footprint but highest allocation count.
+    DYNAMIC_RESERVE_MEMORY_MODE, //< Dynamic allocation at the time of message arrival. Least memory footprint but highest allocation count.
+    DYNAMIC_REUSABLE_MEMORY_MODE //!< Like DYNAMIC_RESERVE_MEMORY_MODE, but released CacheChanges and payloads are kept for reuse. Payloads are grouped in power-of-two size classes, so no allocations are done once the working set has been reached.
 }MemoryManagementPolicy_t;
 
 
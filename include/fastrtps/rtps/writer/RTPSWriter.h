@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <functional>
 #include <chrono>
 
@@ -37,6 +38,7 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class LocalReaderPointer;
 struct CacheChange_t;
 
 
@@ -49,6 +51,7 @@ class RTPSWriter : public Endpoint
     friend class WriterHistory;
     friend class RTPSParticipantImpl;
     friend class RTPSMessageGroup;
+    friend class AsyncInterestTree;
 protected:
     RTPSWriter(
             RTPSParticipantImpl*,
@@ -313,6 +316,34 @@ protected:
      */
     virtual bool change_removed_by_history(CacheChange_t* a_change)=0;
 
+    /**
+     * Look for a matched reader to which changes can be delivered directly, without the transports.
+     * @param reader_guid GUID of the matched reader.
+     * @return Pointer to the reader when it lives in this process and intraprocess delivery is enabled,
+     * nullptr otherwise.
+     */
+    std::shared_ptr<LocalReaderPointer> find_local_reader(const GUID_t& reader_guid) const;
+
+    /**
+     * Get a copy of a change to deliver it to readers living in this process once the writer mutex is released.
+     * The copy references the payload of the change instead of copying it, so it stays valid if the change is
+     * removed from the history meanwhile. Must be called with the writer mutex locked.
+     * @param change Pointer to the change.
+     * @return The copy, or nullptr on error.
+     */
+    std::shared_ptr<CacheChange_t> copy_for_local_delivery(CacheChange_t* change);
+
+    /**
+     * Deliver a change to a reader living in this process.
+     * Must be called without the writer mutex locked, as the reader may notify its listener, which may write.
+     * @param change Pointer to the change.
+     * @param local_reader Reader to deliver the change to.
+     * @return True if the reader processed the change.
+     */
+    bool intraprocess_delivery(
+            CacheChange_t* change,
+            LocalReaderPointer& local_reader);
+
 #if HAVE_SECURITY
     SerializedPayload_t encrypt_payload_;
 
@@ -324,8 +355,16 @@ protected:
     //! The liveliness lease duration of this reader
     Duration_t liveliness_lease_duration_;
 
+    //! Priority of the writer on flow controllers shared with other writers
+    int32_t flow_controller_priority_;
+
 private:
 
+    //! Whether the writer is in the list of writers interested in an asynchronous write.
+    mutable std::atomic<bool> async_interest_registered_;
+    //! Next writer in the list of writers interested in an asynchronous write.
+    mutable const RTPSWriter* async_interest_next_;
+
     RTPSWriter& operator=(const RTPSWriter&) = delete;
 };
 
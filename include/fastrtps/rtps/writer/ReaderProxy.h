@@ -19,6 +19,7 @@
 #define FASTRTPS_RTPS_WRITER_READERPROXY_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include <algorithm>
+#include <array>
 #include <mutex>
 #include <set>
 #include <memory>
@@ -37,6 +38,7 @@ namespace rtps {
 
 class StatefulWriter;
 class NackSupressionDuration;
+class LocalReaderPointer;
 
 /**
  * ReaderProxy class that helps to keep the state of a specific Reader with respect to the RTPSWriter.
@@ -59,8 +61,12 @@ public:
     /**
      * Activate this proxy associating it to a remote reader.
      * @param reader_attributes RemoteReaderAttributes of the reader for which to keep state.
+     * @param local_reader Pointer to the reader when it lives in this process and changes should be delivered to it
+     * directly, nullptr otherwise.
      */
-    void start(const RemoteReaderAttributes& reader_attributes);
+    void start(
+            const RemoteReaderAttributes& reader_attributes,
+            const std::shared_ptr<LocalReaderPointer>& local_reader);
 
     /**
      * Disable this proxy.
@@ -115,10 +121,11 @@ public:
             const SequenceNumber_t& max_seq,
             BinaryFunction f) const
     {
-        if (!changes_for_reader_.empty())
+        if (has_changes())
         {
             SequenceNumber_t current_seq = changes_low_mark_ + 1;
-            ChangeConstIterator it = changes_for_reader_.begin();
+            // Releasing changes from f does not erase them from the collection, so iterators remain valid.
+            ChangeConstIterator it = changes_begin();
             while (it != changes_for_reader_.end())
             {
                 // Holes before this change are informed as irrelevant.
@@ -246,6 +253,49 @@ public:
         return reader_attributes_;
     }
 
+    /**
+     * Check if the reader represented by this proxy lives in this process, so changes are delivered to it directly.
+     * @return true if the reader represented by this proxy is served without the transports.
+     */
+    inline bool is_local_reader() const
+    {
+        return static_cast<bool>(local_reader_);
+    }
+
+    /**
+     * Get the pointer used to deliver changes to the reader represented by this proxy.
+     * @return the pointer to the local reader, nullptr if the reader does not live in this process.
+     */
+    inline const std::shared_ptr<LocalReaderPointer>& local_reader() const
+    {
+        return local_reader_;
+    }
+
+    /**
+     * Mark that a HEARTBEAT has to be passed to the local reader represented by this proxy.
+     * It is passed by the asynchronous thread of the writer, without the writer mutex.
+     * @param liveliness Whether it is a liveliness heartbeat.
+     */
+    inline void request_local_heartbeat(bool liveliness)
+    {
+        local_heartbeat_pending_ = true;
+        local_liveliness_pending_ |= liveliness;
+    }
+
+    /**
+     * Take the HEARTBEAT pending for the local reader represented by this proxy, if any.
+     * @param liveliness Set to whether it is a liveliness heartbeat.
+     * @return true if a HEARTBEAT was pending.
+     */
+    inline bool take_local_heartbeat(bool& liveliness)
+    {
+        liveliness = local_liveliness_pending_;
+        bool pending = local_heartbeat_pending_;
+        local_heartbeat_pending_ = false;
+        local_liveliness_pending_ = false;
+        return pending;
+    }
+
     /**
      * Get the locators that should be used to send data to the reader represented by this proxy.
      * @return the locators that should be used to send data to the reader represented by this proxy.
@@ -339,10 +389,23 @@ private:
     RemoteReaderAttributes reader_attributes_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
+    //!Reader living in this process, served without the transports.
+    std::shared_ptr<LocalReaderPointer> local_reader_;
+    //!Whether a HEARTBEAT is pending for the local reader.
+    bool local_heartbeat_pending_;
+    //!Whether the pending HEARTBEAT is a liveliness one.
+    bool local_liveliness_pending_;
     //!To fool RTPSMessageGroup when using this proxy as single destination
     ResourceLimitedVector<GUID_t> guid_as_vector_;
     //!Set of the changes and its state.
     ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    /*!
+     * Number of changes at the beginning of changes_for_reader_ that have already been acknowledged or removed.
+     * They are erased lazily, so acknowledging changes does not shift the whole collection.
+     */
+    size_t released_changes_;
+    //!Number of changes in changes_for_reader_ (not counting the released ones) on each status.
+    std::array<size_t, UNDERWAY + 1> changes_by_status_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     std::shared_ptr<NackSupressionDuration> nack_supression_event_;
     //! Are timed events enabled?
@@ -359,6 +422,46 @@ private:
 
     void disable_timers();
 
+    //! @return Iterator pointing to the first change not released.
+    ChangeIterator changes_begin()
+    {
+        return changes_for_reader_.begin() + released_changes_;
+    }
+
+    //! @return Iterator pointing to the first change not released.
+    ChangeConstIterator changes_begin() const
+    {
+        return changes_for_reader_.begin() + released_changes_;
+    }
+
+    /*!
+     * @brief Release all the changes before the given one.
+     * Released changes stay in the collection until compact_changes() is called.
+     * @param last Iterator pointing to the first change to keep.
+     */
+    void release_changes(ChangeIterator last);
+
+    /*!
+     * @brief Erase released changes from the collection when worth it.
+     * Invalidates iterators, so it should not be called while the collection is being traversed.
+     * @param force Erase them in any case.
+     */
+    void compact_changes(bool force);
+
+    /*!
+     * @brief Change the status of a change, keeping changes_by_status_ updated.
+     * @param change Change to update.
+     * @param status New status.
+     */
+    void set_change_status(
+            ChangeForReader_t& change,
+            ChangeForReaderStatus_t status)
+    {
+        --changes_by_status_[change.getStatus()];
+        ++changes_by_status_[status];
+        change.setStatus(status);
+    }
+
     /*
      * Converts all changes with a given status to a different status.
      * @param previous Status to change.
@@ -26,6 +26,7 @@
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 #include <condition_variable>
 #include <mutex>
+#include <set>
 
 namespace eprosima {
 namespace fastrtps {
@@ -34,6 +35,8 @@ namespace rtps {
 class ReaderProxy;
 class NackResponseDelay;
 class TimedCallback;
+class HeartbeatScheduler;
+template<class T> class RTPSWriterCollector;
 
 /**
  * Class StatefulWriter, specialization of RTPSWriter that maintains information of each matched Reader.
@@ -61,6 +64,8 @@ protected:
 private:
     //!Timed Event to manage the periodic HB to the Reader.
     PeriodicHeartbeat* mp_periodicHB;
+    //!Participant scheduler sending the periodic HB, used instead of mp_periodicHB when heartbeats are coalesced.
+    HeartbeatScheduler* heartbeat_scheduler_;
     //!Count of the sent heartbeats.
     Count_t m_heartbeatCount;
     //!WriterTimes
@@ -214,6 +219,13 @@ public:
             bool final = false,
             bool liveliness = false);
 
+    /**
+     * @brief Adds the periodic heartbeat to the message groups of the heartbeat scheduler of the participant.
+     * @param scheduler Scheduler providing a message group per destination.
+     * @return True if there are changes not acknowledged yet, so the heartbeat has to be scheduled again.
+     */
+    bool send_coalesced_heartbeat(HeartbeatScheduler& scheduler);
+
     /*!
      * @brief Sends a heartbeat to a remote reader.
      * @remarks This function is non thread-safe.
@@ -266,6 +278,12 @@ public:
 
 private:
 
+    //! Starts the periodic heartbeat, unless it is already started.
+    void restart_periodic_heartbeat();
+
+    //! Stops the periodic heartbeat.
+    void cancel_periodic_heartbeat();
+
     void send_heartbeat_piggyback_nts_(
             RTPSMessageGroup& message_group,
             uint32_t& last_bytes_processed);
@@ -285,6 +303,103 @@ private:
 
     void check_acked_status();
 
+    /**
+     * Work for a reader living in this process. It is gathered with the writer mutex locked and performed after
+     * releasing it, as the reader may notify its listener, which may write on this writer.
+     */
+    struct LocalDelivery
+    {
+        LocalDelivery(
+                const std::shared_ptr<LocalReaderPointer>& local_reader,
+                bool is_reliable)
+            : reader(local_reader)
+            , reliable(is_reliable)
+            , heartbeat(false)
+            , liveliness(false)
+            , heartbeat_count(0)
+            , acknowledged(false)
+        {
+        }
+
+        //! Reader to deliver to.
+        std::shared_ptr<LocalReaderPointer> reader;
+        //! Whether the reader is reliable.
+        bool reliable;
+        //! Copies of the changes to deliver, referencing the payloads of the changes in the history.
+        std::vector<std::shared_ptr<CacheChange_t>> changes;
+        //! Sequence numbers of the changes the reader should consider irrelevant.
+        std::set<SequenceNumber_t> irrelevant;
+        //! Whether a heartbeat has to be processed by the reader.
+        bool heartbeat;
+        //! Whether the heartbeat is a liveliness heartbeat.
+        bool liveliness;
+        //! Count of the heartbeat.
+        uint32_t heartbeat_count;
+        //! First sequence number of the heartbeat.
+        SequenceNumber_t first_seq;
+        //! Last sequence number of the heartbeat.
+        SequenceNumber_t last_seq;
+        //! Whether the reader returned its acknowledgement state after the delivery.
+        bool acknowledged;
+        //! First sequence number the reader has not received yet.
+        SequenceNumber_t ack_base;
+    };
+
+    /**
+     * Get the pending work for a reader living in this process, adding it if it is not on the list yet.
+     * @param deliveries List of pending work.
+     * @param reader_proxy Proxy of the local reader.
+     * @return Reference to the pending work for the reader.
+     */
+    LocalDelivery& local_delivery_nts(
+            std::vector<LocalDelivery>& deliveries,
+            const ReaderProxy& reader_proxy);
+
+    /**
+     * Gather the unsent changes of a reader living in this process, marking them as sent.
+     * @param reader_proxy Proxy of the local reader.
+     * @param deliveries List of pending work, where the work for the reader is added.
+     * @param collector When not null, relevant changes are added to it so they pass through the flow controllers,
+     * and are kept unsent.
+     */
+    void collect_unsent_changes_nts(
+            ReaderProxy& reader_proxy,
+            std::vector<LocalDelivery>& deliveries,
+            RTPSWriterCollector<ReaderProxy*>* collector);
+
+    /**
+     * Fill the heartbeat a reader living in this process will process.
+     * @param delivery Pending work for the reader.
+     * @param liveliness Whether it is a liveliness heartbeat.
+     */
+    void collect_heartbeat_nts(
+            LocalDelivery& delivery,
+            bool liveliness);
+
+    /**
+     * Request a HEARTBEAT for a reader living in this process. It is processed by the reader from the asynchronous
+     * writer thread.
+     * @param reader_proxy Proxy of the local reader.
+     * @param liveliness Whether it is a liveliness heartbeat.
+     */
+    void schedule_local_heartbeat_nts(
+            ReaderProxy& reader_proxy,
+            bool liveliness = false);
+
+    /**
+     * Perform the work gathered for a reader living in this process, as if the messages had been received.
+     * Must be called without the writer mutex locked.
+     * @param delivery Pending work for the reader. Its acknowledgement state is filled for reliable readers.
+     */
+    void deliver_locally(LocalDelivery& delivery);
+
+    /**
+     * Acknowledge the changes a reader living in this process has already received, using the state read from it
+     * instead of waiting for its ACKNACK.
+     * @param delivery Work performed for the reader.
+     */
+    void apply_local_acknack_nts(const LocalDelivery& delivery);
+
     /**
      * @brief A method called when the ack timer expires
      * @details Only used if disable positive ACKs QoS is enabled
@@ -27,6 +27,9 @@
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 
 #include <list>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps{
@@ -133,9 +136,32 @@ private:
 
     void update_locators_nts();
 
+    //! Change pending to be delivered to a reader living in this process.
+    struct LocalUnsentChange
+    {
+        std::shared_ptr<LocalReaderPointer> reader;
+        CacheChange_t* change;
+    };
+
+    //! Copy of a change to be delivered to a reader living in this process once the mutex is released.
+    typedef std::pair<std::shared_ptr<LocalReaderPointer>, std::shared_ptr<CacheChange_t>> LocalDelivery;
+
+    /**
+     * Take the changes pending to be delivered to readers living in this process.
+     * @param change Change to take the deliveries of, or nullptr to take all of them.
+     * @param deliveries List where the copies to deliver are added.
+     */
+    void take_unsent_local_changes_nts(
+            const CacheChange_t* change,
+            std::vector<LocalDelivery>& deliveries);
+
     bool is_inline_qos_expected_ = false;
     LocatorList_t fixed_locators_;
     ResourceLimitedVector<RemoteReaderAttributes> matched_readers_;
+    //! Matched readers living in this process, which are delivered changes directly.
+    ResourceLimitedVector<std::shared_ptr<LocalReaderPointer>> matched_local_readers_;
+    //! Changes pending to be delivered to matched readers living in this process, by the async thread.
+    std::vector<LocalUnsentChange> unsent_local_changes_;
     ResourceLimitedVector<ChangeForReader_t, std::true_type> unsent_changes_;
     std::vector<std::unique_ptr<FlowController> > flow_controllers_;
 };
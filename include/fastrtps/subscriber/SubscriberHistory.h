@@ -27,6 +27,11 @@
 #include "../common/KeyedChanges.h"
 #include "SampleInfo.h"
 
+#include <chrono>
+#include <list>
+#include <map>
+#include <unordered_map>
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -125,12 +130,28 @@ class SubscriberHistory: public rtps::ReaderHistory
 
     private:
 
-        typedef std::map<rtps::InstanceHandle_t, KeyedChanges> t_m_Inst_Caches;
+        typedef std::multimap<std::chrono::steady_clock::time_point, rtps::InstanceHandle_t> t_m_Deadlines;
+        typedef std::list<rtps::InstanceHandle_t> t_l_Handles;
+
+        //!Changes of an instance, along with its position on the deadline and empty instance indexes.
+        struct KeyedInstance : public KeyedChanges
+        {
+            //!Entry of the instance in deadlines_
+            t_m_Deadlines::iterator deadline_it;
+            //!Entry of the instance in empty_instances_, only valid while it has no changes
+            t_l_Handles::iterator empty_it;
+        };
+
+        typedef std::unordered_map<rtps::InstanceHandle_t, KeyedInstance, rtps::InstanceHandleHash> t_m_Inst_Caches;
 
         //!Number of unread CacheChange_t.
         uint64_t m_unreadCacheCount;
         //!Map where keys are instance handles and values vectors of cache changes
         t_m_Inst_Caches keyed_changes_;
+        //!Instances ordered by their next deadline
+        t_m_Deadlines deadlines_;
+        //!Instances without changes, in the order they became empty. First one is evicted when max_instances is reached.
+        t_l_Handles empty_instances_;
         //!Time point when the next deadline will occur (only used for topics with no key)
         std::chrono::steady_clock::time_point next_deadline_us_;
         //!HistoryQosPolicy values.
@@ -153,6 +174,15 @@ class SubscriberHistory: public rtps::ReaderHistory
                 rtps::CacheChange_t* a_change,
                 t_m_Inst_Caches::iterator* map_it);
 
+        /**
+         * @brief Adds a change to the vector of changes of its instance, keeping it ordered by sequence number
+         * @param a_change The change to add
+         * @param map_it A map iterator to the instance of the change
+         */
+        void add_to_instance(
+                rtps::CacheChange_t* a_change,
+                t_m_Inst_Caches::iterator map_it);
+
         //!Increase the unread count.
         inline void increaseUnreadCount()
         {
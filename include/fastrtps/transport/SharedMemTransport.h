@@ -0,0 +1,176 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHAREDMEM_TRANSPORT_H
+#define SHAREDMEM_TRANSPORT_H
+
+#include "TransportInterface.h"
+#include "SharedMemTransportDescriptor.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class SharedMemSegment;
+class SharedMemChannelResource;
+
+/**
+ * Transport between processes running on the same host, through POSIX shared memory.
+ *    - Each port is backed by a shared memory segment holding a lock-free ring of messages. Sending to a
+ *       locator writes the message on the segment of its port, which every listener of the port reads.
+ *
+ *    - Locators have kind LOCATOR_KIND_SHM, and carry an identifier of the host in the last four bytes of
+ *       the address. Locators of other hosts are not supported for sending. Multicast locators have their
+ *       first address byte set to 0xFF.
+ *
+ *    - Opening an input channel for a unicast locator fails if the port already has a unicast listener,
+ *       so participants pick different ports as they do with UDP. Any number of listeners can open a
+ *       multicast locator.
+ *
+ * This transport is only available on Linux, where listeners sleep on a futex in the segment.
+ * @ingroup TRANSPORT_MODULE
+ */
+class SharedMemTransport : public TransportInterface
+{
+public:
+
+    RTPS_DllAPI SharedMemTransport(const SharedMemTransportDescriptor&);
+
+    virtual ~SharedMemTransport() override;
+
+    virtual bool init() override;
+
+    virtual bool IsInputChannelOpen(const Locator_t&) const override;
+
+    virtual bool IsLocatorSupported(const Locator_t&) const override;
+
+    virtual bool is_locator_allowed(const Locator_t&) const override;
+
+    virtual Locator_t RemoteToMainLocal(const Locator_t& remote) const override;
+
+    virtual bool OpenOutputChannel(
+            SendResourceList& sender_resource_list,
+            const Locator_t&) override;
+
+    virtual bool OpenInputChannel(
+            const Locator_t&,
+            TransportReceiverInterface*,
+            uint32_t) override;
+
+    virtual bool CloseInputChannel(const Locator_t&) override;
+
+    virtual bool DoInputLocatorsMatch(const Locator_t&, const Locator_t&) const override;
+
+    virtual LocatorList_t NormalizeLocator(const Locator_t& locator) override;
+
+    virtual LocatorList_t ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists) override;
+
+    virtual bool is_local_locator(const Locator_t& locator) const override;
+
+    TransportDescriptorInterface* get_configuration() override { return &configuration_; }
+
+    virtual void AddDefaultOutputLocator(LocatorList_t &defaultList) override;
+
+    virtual bool getDefaultMetatrafficMulticastLocators(
+            LocatorList_t& locators,
+            uint32_t metatraffic_multicast_port) const override;
+
+    virtual bool getDefaultMetatrafficUnicastLocators(
+            LocatorList_t& locators,
+            uint32_t metatraffic_unicast_port) const override;
+
+    virtual bool getDefaultUnicastLocators(
+            LocatorList_t& locators,
+            uint32_t unicast_port) const override;
+
+    virtual bool fillMetatrafficMulticastLocator(
+            Locator_t& locator,
+            uint32_t metatraffic_multicast_port) const override;
+
+    virtual bool fillMetatrafficUnicastLocator(
+            Locator_t& locator,
+            uint32_t metatraffic_unicast_port) const override;
+
+    virtual bool configureInitialPeerLocator(
+            Locator_t& locator,
+            const PortParameters& port_params,
+            uint32_t domainId,
+            LocatorList_t& list) const override;
+
+    virtual bool fillUnicastLocator(
+            Locator_t& locator,
+            uint32_t well_known_port) const override;
+
+    /**
+     * Writes a message on the segment of the destination port.
+     * @param send_buffer Message to send.
+     * @param send_buffer_size Size of the message.
+     * @param remote_locator Locator describing the destination port.
+     * @return false when the locator belongs to another host or the message could not be written.
+     */
+    virtual bool send(
+            const octet* send_buffer,
+            uint32_t send_buffer_size,
+            const Locator_t& remote_locator);
+
+    /**
+     * Writes a message, described as an ordered list of buffers, on the segments of several ports.
+     * Buffers are copied directly into the message slots, without being gathered first.
+     * @param buffers Ordered list of buffers composing the message.
+     * @param total_bytes Sum of the sizes of all buffers.
+     * @param remote_locators Locators describing the destination ports.
+     * @return true if the message was written on at least one segment.
+     */
+    virtual bool send(
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
+            const LocatorList_t& remote_locators);
+
+protected:
+
+    SharedMemTransportDescriptor configuration_;
+
+    //! Identifier of this host, stored in the address of the locators.
+    uint32_t host_id_;
+
+    mutable std::recursive_mutex input_channels_mutex_;
+    std::map<uint32_t, SharedMemChannelResource*> input_channels_;
+
+    //! Segments written by this transport, opened on the first message sent to each port with listeners.
+    std::mutex output_segments_mutex_;
+    std::map<uint32_t, std::shared_ptr<SharedMemSegment>> output_segments_;
+
+    std::string segment_name(uint32_t port) const;
+
+    std::shared_ptr<SharedMemSegment> get_output_segment(uint32_t port);
+
+    bool send_to_segment(
+            const NetworkBuffer* buffers,
+            size_t count,
+            uint32_t total_bytes,
+            const Locator_t& remote_locator);
+
+    //! Sets the host identifier on a locator, keeping its multicast mark.
+    void fill_local_address(Locator_t& locator) const;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SHAREDMEM_TRANSPORT_H
@@ -0,0 +1,68 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SHAREDMEM_TRANSPORT_DESCRIPTOR_H
+#define SHAREDMEM_TRANSPORT_DESCRIPTOR_H
+
+#include "TransportDescriptorInterface.h"
+#include "../fastrtps_dll.h"
+
+#include <string>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class TransportInterface;
+
+/**
+ * Shared memory transport configuration
+ *
+ * - maxMessageSize:        size of each message slot of a port segment. Messages bigger than this
+ *                          cannot be sent.
+ *
+ * - port_queue_capacity:   number of message slots of each port segment. When a listener falls behind
+ *                          by more than this number of messages, the oldest ones are overwritten.
+ *
+ * - segment_name_prefix:   prefix of the name of the shared memory objects created for each port.
+ *                          Only transports with the same prefix can talk to each other.
+ *
+ * - segment_permissions:   access mode of the shared memory objects created for each port. Defaults to
+ *                          owner only (0600), so only processes of the same user can talk to each other.
+ * @ingroup TRANSPORT_MODULE
+ */
+typedef struct SharedMemTransportDescriptor : public TransportDescriptorInterface
+{
+    virtual ~SharedMemTransportDescriptor(){}
+
+    virtual TransportInterface* create_transport() const override;
+
+    virtual uint32_t min_send_buffer_size() const override;
+
+    RTPS_DllAPI SharedMemTransportDescriptor();
+
+    RTPS_DllAPI SharedMemTransportDescriptor(const SharedMemTransportDescriptor& t);
+
+    uint32_t port_queue_capacity;
+
+    std::string segment_name_prefix;
+
+    uint32_t segment_permissions;
+} SharedMemTransportDescriptor;
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SHAREDMEM_TRANSPORT_DESCRIPTOR_H
@@ -16,6 +16,7 @@
 #define TRANSPORT_RECEIVER_INTERFACE_H
 
 #include "../rtps/common/Locator.h"
+#include "../rtps/common/CDRMessage_t.h"
 
 namespace eprosima {
 namespace fastrtps {
@@ -40,6 +41,23 @@ public:
      */
     virtual void OnDataReceived(const octet* data, const uint32_t size,
         const Locator_t& localLocator, const Locator_t& remote_locator) = 0;
+
+    /**
+     * Method to be called by the transport when several messages were received in a single operation.
+     * The default implementation delivers each message through OnDataReceived.
+     * @param messages Array of received messages. Only buffer and length are meaningful.
+     * @param remote_locators Array with the locator identifying the remote endpoint of each message.
+     * @param count Number of messages in both arrays.
+     * @param localLocator Locator identifying the local endpoint.
+     */
+    virtual void OnDataBatchReceived(const CDRMessage_t* messages, const Locator_t* remote_locators,
+        uint32_t count, const Locator_t& localLocator)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            OnDataReceived(messages[i].buffer, messages[i].length, localLocator, remote_locators[i]);
+        }
+    }
 };
 
 } // namespace rtps
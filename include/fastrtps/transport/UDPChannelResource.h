@@ -19,6 +19,8 @@
 #include <fastrtps/rtps/common/Locator.h>
 #include <asio.hpp>
 
+#include <vector>
+
 namespace eprosima{
 namespace fastrtps{
 namespace rtps{
@@ -82,7 +84,8 @@ public:
         uint32_t maxMsgSize,
         const Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver);
+        TransportReceiverInterface* receiver,
+        uint32_t receive_batch_size = 1);
 
     virtual ~UDPChannelResource() override;
 
@@ -152,6 +155,14 @@ protected:
     void perform_listen_operation(
             Locator_t input_locator);
 
+    /**
+     * Variant of perform_listen_operation that drains several datagrams from the socket on each
+     * system call, and delivers them to the receiver as a single batch.
+     * @param input_locator - Locator that triggered the creation of the resource
+    */
+    void perform_batch_listen_operation(
+            Locator_t input_locator);
+
     /**
     * Blocking Receive from the specified channel.
     * @param receive_buffer vector with enough capacity (not size) to accomodate a full receive buffer. That
@@ -173,6 +184,10 @@ private:
     bool only_multicast_purpose_;
     std::string interface_;
     UDPTransportInterface* transport_;
+    //! Ring of preallocated buffers used on batched receives. Empty when batching is disabled.
+    std::vector<CDRMessage_t> batch_buffers_;
+    //! Remote locator of each message received on the last batch.
+    std::vector<Locator_t> batch_remote_locators_;
 
     UDPChannelResource(const UDPChannelResource&) = delete;
     UDPChannelResource& operator=(const UDPChannelResource&) = delete;
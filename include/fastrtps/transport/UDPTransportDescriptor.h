@@ -55,6 +55,19 @@ typedef struct UDPTransportDescriptor: public SocketTransportDescriptor
     * datagram. This may hinder performance on high-frequency writers.
     */
    bool non_blocking_send = false;
+
+   /**
+    * Maximum number of datagrams drained from a listening socket on each receive call.
+    *
+    * When greater than 1, and the platform supports it (Linux recvmmsg), each listening thread
+    * receives up to this number of datagrams per system call into a ring of preallocated buffers,
+    * and hands them to the upper layer as a single batch. This reduces the number of system calls on
+    * high-rate inputs of small datagrams, at the cost of receive_batch_size * maxMessageSize bytes
+    * of memory per listening socket.
+    *
+    * When set to 1 (the default), one datagram is received per call.
+    */
+   uint32_t receive_batch_size = 1;
 } UDPTransportDescriptor;
 
 } // namespace rtps
@@ -88,6 +88,24 @@ public:
            const Locator_t& remote_locator,
            bool only_multicast_purpose);
 
+   /**
+   * Blocking Send of a message, described as a list of buffers, to several destinations through the specified
+   * channel. Where supported (Linux sendmmsg), the buffers are handed to the kernel as a gather list and all the
+   * destinations are sent on a single system call, so the message is never gathered into a contiguous buffer.
+   * @param buffers Ordered list of buffers composing the message.
+   * @param total_bytes Sum of the sizes of all buffers. It must not exceed the send_buffer_size fed to this class
+   * during construction.
+   * @param socket channel we're sending from.
+   * @param remote_locators Locators describing the remote destinations we're sending to.
+   * @param only_multicast_purpose
+   */
+   virtual bool send(
+           const NetworkBufferList& buffers,
+           uint32_t total_bytes,
+           eProsimaUDPSocket& socket,
+           const LocatorList_t& remote_locators,
+           bool only_multicast_purpose);
+
    virtual LocatorList_t ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists) override;
 
     virtual bool fillMetatrafficMulticastLocator(Locator_t &locator,
@@ -0,0 +1,177 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingBuffer.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_
+
+#include <assert.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Contiguous FIFO collection with random access.
+ *
+ * Elements are pushed at the back and popped from the front of a circular buffer whose capacity is always a power
+ * of two. The buffer only grows, doubling its capacity when full, so once it has reached the working size of the
+ * application, pushing and popping elements do not allocate memory.
+ *
+ * @tparam _Ty      Element type. Should be default constructible and copy assignable.
+ * @tparam _Alloc   Allocator to use on the underlying collection type, defaults to std::allocator<_Ty>.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Ty,
+    typename _Alloc = std::allocator<_Ty> >
+class RingBuffer
+{
+public:
+
+    using collection_type = std::vector<_Ty, _Alloc>;
+    using value_type = _Ty;
+    using allocator_type = _Alloc;
+    using reference = typename collection_type::reference;
+    using const_reference = typename collection_type::const_reference;
+    using size_type = typename collection_type::size_type;
+
+    /**
+     * Construct a RingBuffer.
+     *
+     * @param initial_capacity   Number of elements to preallocate. Rounded up to a power of two.
+     * @param alloc              Allocator object. Forwarded to collection constructor.
+     */
+    explicit RingBuffer(
+            size_type initial_capacity = 0,
+            const allocator_type& alloc = allocator_type())
+        : buffer_(alloc)
+        , head_(0)
+        , size_(0)
+    {
+        if (initial_capacity > 0)
+        {
+            buffer_.resize(round_capacity(initial_capacity));
+        }
+    }
+
+    /**
+     * Add an element at the back of the collection, growing the buffer when it is full.
+     *
+     * @param val   Element to be copied.
+     */
+    void push_back(const value_type& val)
+    {
+        if (size_ == buffer_.size())
+        {
+            grow();
+        }
+
+        buffer_[(head_ + size_) & (buffer_.size() - 1)] = val;
+        ++size_;
+    }
+
+    /**
+     * Remove the element at the front of the collection.
+     * @pre The collection is not empty.
+     */
+    void pop_front() noexcept
+    {
+        assert(size_ > 0);
+        head_ = (head_ + 1) & (buffer_.size() - 1);
+        --size_;
+    }
+
+    /**
+     * Access an element by its position relative to the front of the collection.
+     *
+     * @param pos   Position of the element. Should be less than size().
+     */
+    reference operator[](size_type pos) noexcept
+    {
+        assert(pos < size_);
+        return buffer_[(head_ + pos) & (buffer_.size() - 1)];
+    }
+
+    const_reference operator[](size_type pos) const noexcept
+    {
+        assert(pos < size_);
+        return buffer_[(head_ + pos) & (buffer_.size() - 1)];
+    }
+
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+
+    reference back() noexcept { return (*this)[size_ - 1]; }
+    const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+    size_type size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    size_type capacity() const noexcept { return buffer_.size(); }
+
+    /**
+     * Remove all the elements of the collection. Capacity is kept.
+     */
+    void clear() noexcept
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+private:
+
+    static size_type round_capacity(size_type capacity) noexcept
+    {
+        size_type ret = 1;
+        while (ret < capacity)
+        {
+            ret <<= 1;
+        }
+        return ret;
+    }
+
+    void grow()
+    {
+        collection_type new_buffer(std::max<size_type>(buffer_.size() * 2, 16), buffer_.get_allocator());
+        for (size_type i = 0; i < size_; ++i)
+        {
+            new_buffer[i] = (*this)[i];
+        }
+        buffer_.swap(new_buffer);
+        head_ = 0;
+    }
+
+    //! Storage. Its size is the capacity of the ring, always a power of two.
+    collection_type buffer_;
+
+    //! Position in buffer_ of the front element.
+    size_type head_;
+
+    //! Number of elements in the ring.
+    size_type size_;
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_ */
@@ -56,6 +56,7 @@ extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
 extern const char* NON_BLOCKING_SEND;
+extern const char* RECEIVE_BATCH_SIZE;
 extern const char* WHITE_LIST;
 extern const char* MAX_MESSAGE_SIZE;
 extern const char* MAX_INITIAL_PEERS_RANGE;
@@ -94,6 +95,9 @@ extern const char* IP6_TO_SEND;
 extern const char* THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
+extern const char* ASYNC_WRITER_THREADS;
+extern const char* INTRAPROCESS_DELIVERY;
+extern const char* HEARTBEAT_COALESCING_PERIOD;
 extern const char* PROPERTIES_POLICY;
 extern const char* NAME;
 
@@ -121,6 +125,7 @@ extern const char* PROPAGATE;
 extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
+extern const char* DYNAMIC_REUSABLE;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
@@ -137,6 +142,7 @@ extern const char* TCPv4;
 extern const char* TCPv6;
 extern const char* INIT_ACKNACK_DELAY;
 extern const char* HEARTB_RESP_DELAY;
+extern const char* ACKNACK_COALESCING_WINDOW;
 extern const char* INIT_HEARTB_DELAY;
 extern const char* HEARTB_PERIOD;
 extern const char* NACK_RESP_DELAY;
@@ -211,6 +217,8 @@ extern const char* DEPTH;
 extern const char* ALLOCATED_SAMPLES;
 extern const char* BYTES_PER_SECOND;
 extern const char* PERIOD_MILLISECS;
+extern const char* BURST_SIZE;
+extern const char* PRIORITY;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -236,6 +244,10 @@ extern const char* STATIC_ENDPOINT_XML;
 extern const char* READER_HIST_MEM_POLICY;
 extern const char* WRITER_HIST_MEM_POLICY;
 extern const char* MUTATION_TRIES;
+extern const char* DISCOVERY_PROTOCOL;
+extern const char* DISCOVERY_SERVER_LIST;
+extern const char* CLIENT;
+extern const char* SERVER;
 extern const char* ACCESS_SCOPE;
 extern const char* ENABLED;
 
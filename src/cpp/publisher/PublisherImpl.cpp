@@ -32,7 +32,6 @@
 
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
-#include <fastrtps/rtps/timedevent/TimedCallback.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/builtin/BuiltinProtocols.h>
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
@@ -70,17 +69,12 @@ PublisherImpl::PublisherImpl(
     , mp_userPublisher(nullptr)
     , mp_rtpsParticipant(nullptr)
     , high_mark_for_frag_(0)
-    , deadline_timer_(std::bind(&PublisherImpl::deadline_missed, this),
-                      att.qos.m_deadline.period.to_ns() * 1e-6,
-                      mp_participant->get_resource_event().getIOService(),
-                      mp_participant->get_resource_event().getThread())
+    , timer_wheel_(mp_participant->get_resource_event().get_timer_wheel())
+    , deadline_timers_()
+    , closing_(false)
     , deadline_duration_us_(m_att.qos.m_deadline.period.to_ns() * 1e-3)
-    , timer_owner_()
     , deadline_missed_status_()
-    , lifespan_timer_(std::bind(&PublisherImpl::lifespan_expired, this),
-                      m_att.qos.m_lifespan.duration.to_ns() * 1e-6,
-                      mp_participant->get_resource_event().getIOService(),
-                      mp_participant->get_resource_event().getThread())
+    , lifespan_timer_(timer_wheel_, std::bind(&PublisherImpl::lifespan_expired, this))
     , lifespan_duration_us_(m_att.qos.m_lifespan.duration.to_ns() * 1e-3)
 {
 }
@@ -92,6 +86,20 @@ PublisherImpl::~PublisherImpl()
         logInfo(PUBLISHER, this->getGuid().entityId << " in topic: " << this->m_att.topic.topicName);
     }
 
+    // Timers are stopped before removing the writer, as their callbacks use it.
+    // Once closing, no deadline timer is added or erased, so they can be disabled without the writer mutex, which
+    // their callbacks take.
+    if(mp_writer != nullptr)
+    {
+        std::unique_lock<std::recursive_timed_mutex> lock(mp_writer->getMutex());
+        closing_ = true;
+    }
+    for (auto& deadline_timer : deadline_timers_)
+    {
+        deadline_timer.second.disable();
+    }
+    lifespan_timer_.disable();
+
     RTPSDomain::removeRTPSWriter(mp_writer);
     delete(this->mp_userPublisher);
 }
@@ -213,26 +221,16 @@ bool PublisherImpl::create_new_change_with_params(
 
             if (m_att.qos.m_deadline.period != c_TimeInfinite)
             {
-                if (!m_history.set_next_deadline(
-                            ch->instanceHandle,
-                            steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
+                if (!deadline_timer_reschedule(ch->instanceHandle))
                 {
                     logError(PUBLISHER, "Could not set the next deadline in the history");
                 }
-                else
-                {
-                    if (timer_owner_ == handle || timer_owner_ == InstanceHandle_t())
-                    {
-                        deadline_timer_reschedule();
-                    }
-                }
             }
 
-            if (m_att.qos.m_lifespan.duration != c_TimeInfinite)
+            // Changes are added in order, so the timer only has to be set when no change is waiting to expire.
+            if (m_att.qos.m_lifespan.duration != c_TimeInfinite && !lifespan_timer_.is_scheduled())
             {
-                lifespan_duration_us_ = std::chrono::duration<double, std::ratio<1, 1000000>>(m_att.qos.m_lifespan.duration.to_ns() * 1e-3);
-                lifespan_timer_.update_interval_millisec(m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
-                lifespan_timer_.restart_timer();
+                lifespan_timer_.schedule(steady_clock::now() + duration_cast<steady_clock::duration>(lifespan_duration_us_));
             }
 
             return true;
@@ -345,11 +343,13 @@ bool PublisherImpl::updateAttributes(const PublisherAttributes& att)
         {
             deadline_duration_us_ =
                     duration<double, std::ratio<1, 1000000>>(m_att.qos.m_deadline.period.to_ns() * 1e-3);
-            deadline_timer_.update_interval_millisec(m_att.qos.m_deadline.period.to_ns() * 1e-6);
         }
         else
         {
-            deadline_timer_.cancel_timer();
+            for (auto& deadline_timer : deadline_timers_)
+            {
+                deadline_timer.second.cancel();
+            }
         }
 
         // Lifespan
@@ -358,11 +358,10 @@ bool PublisherImpl::updateAttributes(const PublisherAttributes& att)
         {
             lifespan_duration_us_ =
                     duration<double, std::ratio<1, 1000000>>(m_att.qos.m_lifespan.duration.to_ns() * 1e-3);
-            lifespan_timer_.update_interval_millisec(m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
         }
         else
         {
-            lifespan_timer_.cancel_timer();
+            lifespan_timer_.cancel();
         }
     }
 
@@ -408,45 +407,67 @@ bool PublisherImpl::wait_for_all_acked(const eprosima::fastrtps::Time_t& max_wai
     return mp_writer->wait_for_all_acked(max_wait);
 }
 
-void PublisherImpl::deadline_timer_reschedule()
+bool PublisherImpl::deadline_timer_reschedule(const InstanceHandle_t& handle)
 {
     assert(m_att.qos.m_deadline.period != c_TimeInfinite);
 
     std::unique_lock<std::recursive_timed_mutex> lock(mp_writer->getMutex());
 
-    steady_clock::time_point next_deadline_us;
-    if (!m_history.get_next_deadline(timer_owner_, next_deadline_us))
+    if (closing_)
     {
-        logError(PUBLISHER, "Could not get the next deadline from the history");
-        return;
+        return false;
     }
-    auto interval_ms = duration_cast<milliseconds>(next_deadline_us - steady_clock::now());
 
-    deadline_timer_.cancel_timer();
-    deadline_timer_.update_interval_millisec((double)interval_ms.count());
-    deadline_timer_.restart_timer();
+    steady_clock::time_point next_deadline_us =
+        steady_clock::now() + duration_cast<steady_clock::duration>(deadline_duration_us_);
+    if (!m_history.set_next_deadline(handle, next_deadline_us))
+    {
+        // The instance was removed from the history, so its timer is not needed anymore.
+        // This may be called from the callback of the timer, which is allowed to destroy it.
+        deadline_timers_.erase(handle);
+        return false;
+    }
+
+    auto deadline_timer = deadline_timers_.find(handle);
+    if (deadline_timer == deadline_timers_.end())
+    {
+        deadline_timer = deadline_timers_.emplace(
+                std::piecewise_construct,
+                std::forward_as_tuple(handle),
+                std::forward_as_tuple(timer_wheel_, std::bind(&PublisherImpl::deadline_missed, this, handle))).first;
+    }
+
+    deadline_timer->second.schedule(next_deadline_us);
+    return true;
 }
 
-void PublisherImpl::deadline_missed()
+void PublisherImpl::deadline_missed(const InstanceHandle_t& handle)
 {
-    assert(m_att.qos.m_deadline.period != c_TimeInfinite);
-
     std::unique_lock<std::recursive_timed_mutex> lock(mp_writer->getMutex());
 
-    deadline_missed_status_.total_count++;
-    deadline_missed_status_.total_count_change++;
-    deadline_missed_status_.last_instance_handle = timer_owner_;
-    mp_listener->on_offered_deadline_missed(mp_userPublisher, deadline_missed_status_);
-    deadline_missed_status_.total_count_change = 0;
+    // The instance could have been written, or the deadline disabled, while waiting for the mutex
+    if (closing_ || m_att.qos.m_deadline.period == c_TimeInfinite)
+    {
+        return;
+    }
+
+    auto deadline_timer = deadline_timers_.find(handle);
+    if (deadline_timer == deadline_timers_.end() || deadline_timer->second.is_scheduled())
+    {
+        return;
+    }
 
-    if (!m_history.set_next_deadline(
-                timer_owner_,
-                steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
+    // Instances removed from the history do not miss deadlines
+    if (!deadline_timer_reschedule(handle))
     {
-        logError(PUBLISHER, "Could not set the next deadline in the history");
         return;
     }
-    deadline_timer_reschedule();
+
+    deadline_missed_status_.total_count++;
+    deadline_missed_status_.total_count_change++;
+    deadline_missed_status_.last_instance_handle = handle;
+    mp_listener->on_offered_deadline_missed(mp_userPublisher, deadline_missed_status_);
+    deadline_missed_status_.total_count_change = 0;
 }
 
 void PublisherImpl::get_offered_deadline_missed_status(OfferedDeadlineMissedStatus &status)
@@ -461,42 +482,31 @@ void PublisherImpl::lifespan_expired()
 {
     std::unique_lock<std::recursive_timed_mutex> lock(mp_writer->getMutex());
 
-    CacheChange_t* earliest_change;
-    if (!m_history.get_earliest_change(&earliest_change))
+    if (m_att.qos.m_lifespan.duration == c_TimeInfinite)
     {
         return;
     }
 
-    auto source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
-    auto now = system_clock::now();
-
-    // Check that the earliest change has expired (the change which started the timer could have been removed from the history)
-    if (now - source_timestamp < lifespan_duration_us_)
+    // Remove every expired change, and set the timer for the first one still alive
+    CacheChange_t* earliest_change;
+    while (m_history.get_earliest_change(&earliest_change))
     {
-        auto interval = source_timestamp - now + lifespan_duration_us_;
-        lifespan_timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        lifespan_timer_.restart_timer();
-        return;
-    }
+        auto source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
+        auto now = system_clock::now();
 
-    // The earliest change has expired
-    m_history.remove_change_pub(earliest_change);
+        if (now - source_timestamp < lifespan_duration_us_)
+        {
+            auto interval = source_timestamp - now + lifespan_duration_us_;
+            lifespan_timer_.schedule(steady_clock::now() + duration_cast<steady_clock::duration>(interval));
+            return;
+        }
 
-    // Set the timer for the next change if there is one
-    if (!m_history.get_earliest_change(&earliest_change))
-    {
-        return;
+        if (!m_history.remove_change_pub(earliest_change))
+        {
+            logError(PUBLISHER, "Could not remove an expired change from the history");
+            return;
+        }
     }
-
-    // Calculate when the next change is due to expire and restart
-    source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
-    now = system_clock::now();
-    auto interval = source_timestamp - now + lifespan_duration_us_;
-
-    assert(interval.count() > 0);
-
-    lifespan_timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    lifespan_timer_.restart_timer();
 }
 
 void PublisherImpl::get_liveliness_lost_status(LivelinessLostStatus &status)
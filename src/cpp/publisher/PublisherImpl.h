@@ -30,9 +30,11 @@
 #include <fastrtps/publisher/PublisherHistory.h>
 
 #include <fastrtps/rtps/writer/WriterListener.h>
-#include <fastrtps/rtps/timedevent/TimedCallback.h>
+#include "../rtps/resources/TimerWheel.h"
 #include <fastrtps/qos/DeadlineMissedStatus.h>
 
+#include <unordered_map>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps
@@ -183,29 +185,34 @@ class PublisherImpl
 
     uint32_t high_mark_for_frag_;
 
-    //! A timer used to check for deadlines
-    rtps::TimedCallback deadline_timer_;
+    //! The timer wheel of the participant, used for deadline and lifespan timers
+    rtps::TimerWheel& timer_wheel_;
+    //! Deadline timers of each instance
+    std::unordered_map<rtps::InstanceHandle_t, rtps::TimerWheel::Entry, rtps::InstanceHandleHash> deadline_timers_;
+    //! Set under the writer mutex when the deadline timers are being disabled, so no timer is added meanwhile
+    bool closing_;
     //! Deadline duration in microseconds
     std::chrono::duration<double, std::ratio<1,1000000>> deadline_duration_us_;
-    //! The current timer owner, i.e. the instance which started the deadline timer
-    rtps::InstanceHandle_t timer_owner_;
     //! The offered deadline missed status
     OfferedDeadlineMissedStatus deadline_missed_status_;
 
-    //! A timed callback to remove expired samples for lifespan QoS
-    rtps::TimedCallback lifespan_timer_;
+    //! A timer to remove expired samples for lifespan QoS, scheduled for the earliest sample in the history
+    rtps::TimerWheel::Entry lifespan_timer_;
     //! The lifespan duration, in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
     /**
      * @brief A method called when an instance misses the deadline
+     * @param handle The handle of the instance
      */
-    void deadline_missed();
+    void deadline_missed(const rtps::InstanceHandle_t& handle);
 
     /**
-     * @brief A method to reschedule the deadline timer
+     * @brief A method to set the next deadline of an instance one period from now, and schedule its timer
+     * @param handle The handle of the instance
+     * @return False if the instance is not in the history
      */
-    void deadline_timer_reschedule();
+    bool deadline_timer_reschedule(const rtps::InstanceHandle_t& handle);
 
     /**
      * @brief A method to remove expired samples, invoked when the lifespan timer expires
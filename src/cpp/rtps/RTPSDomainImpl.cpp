@@ -0,0 +1,71 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSDomainImpl.cpp
+ */
+
+#include "RTPSDomainImpl.h"
+
+#include <fastrtps/rtps/reader/RTPSReader.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+std::mutex RTPSDomainImpl::m_mutex;
+std::unordered_map<GUID_t, std::shared_ptr<LocalReaderPointer>, GUIDHash> RTPSDomainImpl::m_localReaders;
+
+void RTPSDomainImpl::register_local_reader(RTPSReader* reader)
+{
+    std::shared_ptr<LocalReaderPointer> local_reader =
+        std::make_shared<LocalReaderPointer>(reader, reader->getGuid());
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_localReaders[reader->getGuid()] = local_reader;
+}
+
+void RTPSDomainImpl::unregister_local_reader(RTPSReader* reader)
+{
+    std::shared_ptr<LocalReaderPointer> local_reader;
+
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        auto it = m_localReaders.find(reader->getGuid());
+        if (it == m_localReaders.end())
+        {
+            return;
+        }
+        local_reader = it->second;
+        m_localReaders.erase(it);
+    }
+
+    // Writers may still hold the pointer, but will not reach the reader anymore
+    local_reader->deactivate();
+}
+
+std::shared_ptr<LocalReaderPointer> RTPSDomainImpl::find_local_reader(const GUID_t& reader_guid)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_localReaders.find(reader_guid);
+    if (it == m_localReaders.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,73 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSDomainImpl.h
+ */
+#ifndef _RTPS_RTPSDOMAINIMPL_H_
+#define _RTPS_RTPSDOMAINIMPL_H_
+
+#include <fastrtps/rtps/common/Guid.h>
+
+#include "reader/LocalReaderPointer.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/*!
+ * @brief Process wide registry of the user readers, used to find the readers a writer can deliver to directly.
+ */
+class RTPSDomainImpl
+{
+public:
+
+    /*!
+     * @brief Makes a reader available for intraprocess delivery.
+     * @param reader Reader to register.
+     */
+    static void register_local_reader(RTPSReader* reader);
+
+    /*!
+     * @brief Makes a reader unavailable for intraprocess delivery.
+     * When this method returns, no writer is accessing the reader, and none will do it again.
+     * @param reader Reader to unregister.
+     */
+    static void unregister_local_reader(RTPSReader* reader);
+
+    /*!
+     * @brief Looks for a reader in this process.
+     * @param reader_guid GUID of the reader.
+     * @return Pointer to the reader, or nullptr if it does not live in this process.
+     */
+    static std::shared_ptr<LocalReaderPointer> find_local_reader(const GUID_t& reader_guid);
+
+private:
+
+    static std::mutex m_mutex;
+
+    static std::unordered_map<GUID_t, std::shared_ptr<LocalReaderPointer>, GUIDHash> m_localReaders;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_RTPSDOMAINIMPL_H_
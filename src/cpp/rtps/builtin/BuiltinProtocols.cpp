@@ -21,6 +21,7 @@
 #include <fastrtps/rtps/common/Locator.h>
 
 #include <fastrtps/rtps/builtin/discovery/participant/PDPSimple.h>
+#include <fastrtps/rtps/builtin/discovery/participant/PDPServer.h>
 #include <fastrtps/rtps/builtin/discovery/endpoint/EDP.h>
 
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
@@ -77,7 +78,14 @@ bool BuiltinProtocols::initBuiltinProtocols(RTPSParticipantImpl* p_part, Builtin
 
     if(m_att.use_SIMPLE_RTPSParticipantDiscoveryProtocol)
     {
-        mp_PDP = new PDPSimple(this);
+        if(m_att.discoveryProtocol == DiscoveryProtocol_t::SERVER)
+        {
+            mp_PDP = new PDPServer(this);
+        }
+        else
+        {
+            mp_PDP = new PDPSimple(this);
+        }
         if(!mp_PDP->initPDP(mp_participantImpl)){
             logError(RTPS_PDP,"Participant discovery configuration failed");
             return false;
@@ -41,6 +41,7 @@
 
 #include <fastrtps/types/TypeObjectFactory.h>
 
+#include <algorithm>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -89,6 +90,7 @@ bool EDP::newLocalReaderProxyData(RTPSReader* reader, const TopicAttributes& att
     }
 #endif
     reader->m_acceptMessagesFromUnkownWriters = false;
+    mp_RTPSParticipant->readerFilterChanged(reader);
 
     if (att.getTopicDiscoveryKind() != NO_CHECK)
     {
@@ -639,56 +641,54 @@ bool EDP::pairingReader(RTPSReader* R, const ParticipantProxyData& pdata, const
     logInfo(RTPS_EDP, rdata.guid() <<" in topic: \"" << rdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for(std::vector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit!=mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Writers on other topics never match, so they cannot have been matched before either.
+    const std::vector<WriterProxyData*>& writers = mp_PDP->topic_writers(rdata.topicName().c_str());
+    for(size_t i = 0; i < writers.size(); ++i)
     {
-        for(std::vector<WriterProxyData*>::iterator wdatait = (*pit)->m_writers.begin();
-                wdatait != (*pit)->m_writers.end(); ++wdatait)
-        {
-            bool valid = validMatching(&rdata, *wdatait);
+        WriterProxyData* wdata = writers[i];
+        bool valid = validMatching(&rdata, wdata);
 
-            if(valid)
-            {
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                            **wdatait, R->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << R->getGuid());
-                }
+            GUID_t participant_guid(wdata->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if(!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, participant_guid,
+                        *wdata, R->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << R->getGuid());
+            }
 #else
-				RemoteWriterAttributes rwatt = (*wdatait)->toRemoteWriterAttributes();
-                if(R->matched_writer_add(rwatt))
+            RemoteWriterAttributes rwatt = wdata->toRemoteWriterAttributes();
+            if(R->matched_writer_add(rwatt))
+            {
+                logInfo(RTPS_EDP, "Valid Matching to writerProxy: " << wdata->guid());
+                //MATCHED AND ADDED CORRECTLY:
+                if(R->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP, "Valid Matching to writerProxy: " << (*wdatait)->guid());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(R->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = (*wdatait)->guid();
-                        R->getListener()->onReaderMatched(R,info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = wdata->guid();
+                    R->getListener()->onReaderMatched(R,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            if(R->matched_writer_is_matched(wdata->toRemoteWriterAttributes())
+                    && R->matched_writer_remove(wdata->toRemoteWriterAttributes()))
             {
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
-                if(R->matched_writer_is_matched((*wdatait)->toRemoteWriterAttributes())
-                        && R->matched_writer_remove((*wdatait)->toRemoteWriterAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(R->getGuid(), pdata.m_guid, (*wdatait)->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(R->getGuid(), pdata.m_guid, wdata->guid());
 #endif
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(R->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = (*wdatait)->guid();
-                        R->getListener()->onReaderMatched(R,info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(R->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = wdata->guid();
+                    R->getListener()->onReaderMatched(R,info);
                 }
             }
         }
@@ -704,55 +704,53 @@ bool EDP::pairingWriter(RTPSWriter* W, const ParticipantProxyData& pdata, const
     logInfo(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for(std::vector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit!=mp_PDP->ParticipantProxiesEnd(); ++pit)
+    // Readers on other topics never match, so they cannot have been matched before either.
+    const std::vector<ReaderProxyData*>& readers = mp_PDP->topic_readers(wdata.topicName().c_str());
+    for(size_t i = 0; i < readers.size(); ++i)
     {
-        for(std::vector<ReaderProxyData*>::iterator rdatait = (*pit)->m_readers.begin();
-                rdatait!=(*pit)->m_readers.end(); ++rdatait)
-        {
-            bool valid = validMatching(&wdata, *rdatait);
+        ReaderProxyData* rdata = readers[i];
+        bool valid = validMatching(&wdata, rdata);
 
-            if(valid)
-            {
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                            **rdatait, W->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            GUID_t participant_guid(rdata->guid().guidPrefix, c_EntityId_RTPSParticipant);
+            if(!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), participant_guid,
+                        *rdata, W->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-				RemoteReaderAttributes rratt = (*rdatait)->toRemoteReaderAttributes();
-				if(W->matched_reader_add(rratt))
+            RemoteReaderAttributes rratt = rdata->toRemoteReaderAttributes();
+            if(W->matched_reader_add(rratt))
+            {
+                logInfo(RTPS_EDP,"Valid Matching to readerProxy: " << rdata->guid());
+                //MATCHED AND ADDED CORRECTLY:
+                if(W->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP,"Valid Matching to readerProxy: " << (*rdatait)->guid());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(W->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = (*rdatait)->guid();
-                        W->getListener()->onWriterMatched(W,info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = rdata->guid();
+                    W->getListener()->onWriterMatched(W,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            if(W->matched_reader_is_matched(rdata->toRemoteReaderAttributes()) &&
+                    W->matched_reader_remove(rdata->toRemoteReaderAttributes()))
             {
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<(*wdatait)->m_guid<<RTPS_DEF<<endl);
-                if(W->matched_reader_is_matched((*rdatait)->toRemoteReaderAttributes()) &&
-                        W->matched_reader_remove((*rdatait)->toRemoteReaderAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), pdata.m_guid, (*rdatait)->guid());
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), pdata.m_guid, rdata->guid());
 #endif
-                    //MATCHED AND ADDED CORRECTLY:
-                    if(W->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = (*rdatait)->guid();
-                        W->getListener()->onWriterMatched(W,info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(W->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = rdata->guid();
+                    W->getListener()->onWriterMatched(W,info);
                 }
             }
         }
@@ -767,58 +765,65 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(ParticipantProxyData* pdata
     logInfo(RTPS_EDP, rdata->guid() <<" in topic: \"" << rdata->topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for(std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit!=mp_RTPSParticipant->userWritersListEnd();++wit)
+
+    // Only the local writers on the same topic are candidates.
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    const std::vector<WriterProxyData*>& writers = mp_PDP->topic_writers(rdata->topicName().c_str());
+    for(size_t i = 0; i < writers.size(); ++i)
     {
-        (*wit)->getMutex().lock();
-        GUID_t writerGUID = (*wit)->getGuid();
-        (*wit)->getMutex().unlock();
-        ParticipantProxyData wpdata;
-        WriterProxyData wdata;
-        if(mp_PDP->lookupWriterProxyData(writerGUID, wdata, wpdata))
+        const WriterProxyData* wdata = writers[i];
+        if(wdata->guid().guidPrefix != local_prefix)
         {
-            bool valid = validMatching(&wdata, rdata);
+            continue;
+        }
 
-            if(valid)
-            {
+        RTPSWriter* writer = find_local_writer(wdata->guid());
+        if(writer == nullptr)
+        {
+            continue;
+        }
+
+        bool valid = validMatching(wdata, rdata);
+
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_reader(writerGUID, pdata->m_guid,
-                            *rdata, (*wit)->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << writerGUID);
-                }
+            if(!mp_RTPSParticipant->security_manager().discovered_reader(wdata->guid(), pdata->m_guid,
+                        *rdata, writer->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << wdata->guid());
+            }
 #else
-                RemoteReaderAttributes rratt = rdata->toRemoteReaderAttributes();
-                if((*wit)->matched_reader_add(rratt))
+            RemoteReaderAttributes rratt = rdata->toRemoteReaderAttributes();
+            if(writer->matched_reader_add(rratt))
+            {
+                logInfo(RTPS_EDP, "Valid Matching to local writer: " << wdata->guid().entityId);
+                //MATCHED AND ADDED CORRECTLY:
+                if(writer->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP, "Valid Matching to local writer: " << writerGUID.entityId);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if((*wit)->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = rdata->guid();
-                        (*wit)->getListener()->onWriterMatched((*wit),info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = rdata->guid();
+                    writer->getListener()->onWriterMatched(writer,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            if(writer->matched_reader_is_matched(rdata->toRemoteReaderAttributes())
+                    && writer->matched_reader_remove(rdata->toRemoteReaderAttributes()))
             {
-                if((*wit)->matched_reader_is_matched(rdata->toRemoteReaderAttributes())
-                        && (*wit)->matched_reader_remove(rdata->toRemoteReaderAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader((*wit)->getGuid(), pdata->m_guid, rdata->guid());
+                mp_RTPSParticipant->security_manager().remove_reader(wdata->guid(), pdata->m_guid, rdata->guid());
 #endif
-                    //MATCHED AND ADDED CORRECTLY:
-                    if((*wit)->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = rdata->guid();
-                        (*wit)->getListener()->onWriterMatched((*wit),info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(writer->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = rdata->guid();
+                    writer->getListener()->onWriterMatched(writer,info);
                 }
             }
         }
@@ -834,44 +839,42 @@ bool EDP::pairing_reader_proxy_with_local_writer(const GUID_t& local_writer, con
     logInfo(RTPS_EDP, rdata.guid() <<" in topic: \"" << rdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for(std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit!=mp_RTPSParticipant->userWritersListEnd();++wit)
+
+    RTPSWriter* writer = find_local_writer(local_writer);
+    if(writer != nullptr)
     {
-        (*wit)->getMutex().lock();
-        GUID_t writerGUID = (*wit)->getGuid();
-        (*wit)->getMutex().unlock();
+        const std::vector<WriterProxyData*>& writers = mp_PDP->topic_writers(rdata.topicName().c_str());
+        auto wit = std::find_if(writers.begin(), writers.end(), [&local_writer](const WriterProxyData* wdata)
+                {
+                    return wdata->guid() == local_writer;
+                });
 
-        if(local_writer == writerGUID)
+        if(wit != writers.end())
         {
-            ParticipantProxyData wpdata;
-            WriterProxyData wdata;
-            if(mp_PDP->lookupWriterProxyData(writerGUID, wdata, wpdata))
-            {
-                bool valid = validMatching(&wdata, &rdata);
+            bool valid = validMatching(*wit, &rdata);
 
-                if(valid)
+            if(valid)
+            {
+                if(!mp_RTPSParticipant->security_manager().discovered_reader(local_writer,
+                            remote_participant_guid, rdata, writer->getAttributes().security_attributes()))
                 {
-                    if(!mp_RTPSParticipant->security_manager().discovered_reader(writerGUID,
-                                remote_participant_guid, rdata, (*wit)->getAttributes().security_attributes()))
-                    {
-                        logError(RTPS_EDP, "Security manager returns an error for writer " << writerGUID);
-                    }
+                    logError(RTPS_EDP, "Security manager returns an error for writer " << local_writer);
                 }
-                else
+            }
+            else
+            {
+                if(writer->matched_reader_is_matched(rdata.toRemoteReaderAttributes())
+                        && writer->matched_reader_remove(rdata.toRemoteReaderAttributes()))
                 {
-                    if((*wit)->matched_reader_is_matched(rdata.toRemoteReaderAttributes())
-                            && (*wit)->matched_reader_remove(rdata.toRemoteReaderAttributes()))
+                    mp_RTPSParticipant->security_manager().remove_reader(local_writer,
+                            remote_participant_guid, rdata.guid());
+                    //MATCHED AND ADDED CORRECTLY:
+                    if(writer->getListener()!=nullptr)
                     {
-                        mp_RTPSParticipant->security_manager().remove_reader((*wit)->getGuid(),
-                                remote_participant_guid, rdata.guid());
-                        //MATCHED AND ADDED CORRECTLY:
-                        if((*wit)->getListener()!=nullptr)
-                        {
-                            MatchingInfo info;
-                            info.status = REMOVED_MATCHING;
-                            info.remoteEndpointGuid = rdata.guid();
-                            (*wit)->getListener()->onWriterMatched((*wit),info);
-                        }
+                        MatchingInfo info;
+                        info.status = REMOVED_MATCHING;
+                        info.remoteEndpointGuid = rdata.guid();
+                        writer->getListener()->onWriterMatched(writer,info);
                     }
                 }
             }
@@ -925,59 +928,65 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(ParticipantProxyData *pdata
     logInfo(RTPS_EDP, wdata->guid() <<" in topic: \"" << wdata->topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for(std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit!=mp_RTPSParticipant->userReadersListEnd();++rit)
+
+    // Only the local readers on the same topic are candidates.
+    const GuidPrefix_t& local_prefix = mp_RTPSParticipant->getGuid().guidPrefix;
+    const std::vector<ReaderProxyData*>& readers = mp_PDP->topic_readers(wdata->topicName().c_str());
+    for(size_t i = 0; i < readers.size(); ++i)
     {
-        GUID_t readerGUID;
-        (*rit)->getMutex().lock();
-        readerGUID = (*rit)->getGuid();
-        (*rit)->getMutex().unlock();
-        ParticipantProxyData rpdata;
-        ReaderProxyData rdata;
-        if(mp_PDP->lookupReaderProxyData(readerGUID, rdata, rpdata))
+        const ReaderProxyData* rdata = readers[i];
+        if(rdata->guid().guidPrefix != local_prefix)
         {
-            bool valid = validMatching(&rdata, wdata);
+            continue;
+        }
 
-            if(valid)
-            {
+        RTPSReader* reader = find_local_reader(rdata->guid());
+        if(reader == nullptr)
+        {
+            continue;
+        }
+
+        bool valid = validMatching(rdata, wdata);
+
+        if(valid)
+        {
 #if HAVE_SECURITY
-                if(!mp_RTPSParticipant->security_manager().discovered_writer(readerGUID, pdata->m_guid,
-                            *wdata, (*rit)->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << readerGUID);
-                }
+            if(!mp_RTPSParticipant->security_manager().discovered_writer(rdata->guid(), pdata->m_guid,
+                        *wdata, reader->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << rdata->guid());
+            }
 #else
-				RemoteWriterAttributes rwatt = wdata->toRemoteWriterAttributes();
-                if((*rit)->matched_writer_add(rwatt))
+            RemoteWriterAttributes rwatt = wdata->toRemoteWriterAttributes();
+            if(reader->matched_writer_add(rwatt))
+            {
+                logInfo(RTPS_EDP, "Valid Matching to local reader: " << rdata->guid().entityId);
+                //MATCHED AND ADDED CORRECTLY:
+                if(reader->getListener()!=nullptr)
                 {
-                    logInfo(RTPS_EDP, "Valid Matching to local reader: " << readerGUID.entityId);
-                    //MATCHED AND ADDED CORRECTLY:
-                    if((*rit)->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = wdata->guid();
-                        (*rit)->getListener()->onReaderMatched((*rit),info);
-                    }
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = wdata->guid();
+                    reader->getListener()->onReaderMatched(reader,info);
                 }
-#endif
             }
-            else
+#endif
+        }
+        else
+        {
+            if(reader->matched_writer_is_matched(wdata->toRemoteWriterAttributes())
+                    && reader->matched_writer_remove(wdata->toRemoteWriterAttributes()))
             {
-                if((*rit)->matched_writer_is_matched(wdata->toRemoteWriterAttributes())
-                        && (*rit)->matched_writer_remove(wdata->toRemoteWriterAttributes()))
-                {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer((*rit)->getGuid(), pdata->m_guid, wdata->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(rdata->guid(), pdata->m_guid, wdata->guid());
 #endif
-                    //MATCHED AND ADDED CORRECTLY:
-                    if((*rit)->getListener()!=nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = wdata->guid();
-                        (*rit)->getListener()->onReaderMatched((*rit),info);
-                    }
+                //MATCHED AND ADDED CORRECTLY:
+                if(reader->getListener()!=nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = wdata->guid();
+                    reader->getListener()->onReaderMatched(reader,info);
                 }
             }
         }
@@ -992,45 +1001,42 @@ bool EDP::pairing_writer_proxy_with_local_reader(const GUID_t& local_reader, con
     logInfo(RTPS_EDP, wdata.guid() <<" in topic: \"" << wdata.topicName() <<"\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for(std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit!=mp_RTPSParticipant->userReadersListEnd();++rit)
+
+    RTPSReader* reader = find_local_reader(local_reader);
+    if(reader != nullptr)
     {
-        GUID_t readerGUID;
-        (*rit)->getMutex().lock();
-        readerGUID = (*rit)->getGuid();
-        (*rit)->getMutex().unlock();
+        const std::vector<ReaderProxyData*>& readers = mp_PDP->topic_readers(wdata.topicName().c_str());
+        auto rit = std::find_if(readers.begin(), readers.end(), [&local_reader](const ReaderProxyData* rdata)
+                {
+                    return rdata->guid() == local_reader;
+                });
 
-        if(local_reader == readerGUID)
+        if(rit != readers.end())
         {
-            ParticipantProxyData rpdata;
-            ReaderProxyData rdata;
-            if(mp_PDP->lookupReaderProxyData(readerGUID, rdata, rpdata))
-            {
-                bool valid = validMatching(&rdata, &wdata);
+            bool valid = validMatching(*rit, &wdata);
 
-                if(valid)
+            if(valid)
+            {
+                if(!mp_RTPSParticipant->security_manager().discovered_writer(local_reader,
+                            remote_participant_guid, wdata, reader->getAttributes().security_attributes()))
                 {
-                    if(!mp_RTPSParticipant->security_manager().discovered_writer(readerGUID,
-                                remote_participant_guid, wdata, (*rit)->getAttributes().security_attributes()))
-                    {
-                        logError(RTPS_EDP, "Security manager returns an error for reader " << readerGUID);
-                    }
+                    logError(RTPS_EDP, "Security manager returns an error for reader " << local_reader);
                 }
-                else
+            }
+            else
+            {
+                if(reader->matched_writer_is_matched(wdata.toRemoteWriterAttributes())
+                        && reader->matched_writer_remove(wdata.toRemoteWriterAttributes()))
                 {
-                    if((*rit)->matched_writer_is_matched(wdata.toRemoteWriterAttributes())
-                            && (*rit)->matched_writer_remove(wdata.toRemoteWriterAttributes()))
+                    mp_RTPSParticipant->security_manager().remove_writer(local_reader,
+                            remote_participant_guid, wdata.guid());
+                    //MATCHED AND ADDED CORRECTLY:
+                    if(reader->getListener()!=nullptr)
                     {
-                        mp_RTPSParticipant->security_manager().remove_writer((*rit)->getGuid(),
-                                remote_participant_guid, wdata.guid());
-                        //MATCHED AND ADDED CORRECTLY:
-                        if((*rit)->getListener()!=nullptr)
-                        {
-                            MatchingInfo info;
-                            info.status = REMOVED_MATCHING;
-                            info.remoteEndpointGuid = wdata.guid();
-                            (*rit)->getListener()->onReaderMatched((*rit),info);
-                        }
+                        MatchingInfo info;
+                        info.status = REMOVED_MATCHING;
+                        info.remoteEndpointGuid = wdata.guid();
+                        reader->getListener()->onReaderMatched(reader,info);
                     }
                 }
             }
@@ -1077,6 +1083,17 @@ bool EDP::pairing_remote_writer_with_local_reader_after_security(const GUID_t& l
     return pairing_remote_writer_with_local_builtin_reader_after_security(local_reader, remote_writer_data);
 }
 #endif
+
+RTPSWriter* EDP::find_local_writer(const GUID_t& writer_guid)
+{
+    return mp_RTPSParticipant->find_user_writer(writer_guid);
+}
+
+RTPSReader* EDP::find_local_reader(const GUID_t& reader_guid)
+{
+    return mp_RTPSParticipant->find_user_reader(reader_guid);
+}
+
 /*
 bool EDP::checkTypeIdentifier(const TypeIdentifier * wti, const TypeIdentifier * rti) const
 {
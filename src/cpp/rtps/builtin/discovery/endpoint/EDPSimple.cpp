@@ -36,6 +36,7 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <cstring>
 #include <mutex>
 
 namespace eprosima {
@@ -508,19 +509,7 @@ bool EDPSimple::processLocalReaderProxyData(RTPSReader* local_reader, ReaderProx
             rdata->writeToCDRMessage(&aux_msg, true);
             change->serializedPayload.length = (uint16_t)aux_msg.length;
 
-            {
-                std::unique_lock<std::recursive_timed_mutex> lock(*writer->second->getMutex());
-                for(auto ch = writer->second->changesBegin(); ch != writer->second->changesEnd(); ++ch)
-                {
-                    if((*ch)->instanceHandle == change->instanceHandle)
-                    {
-                        writer->second->remove_change(*ch);
-                        break;
-                    }
-                }
-            }
-
-            writer->second->add_change(change);
+            publishLocalProxyData(*writer, change);
 
             return true;
         }
@@ -563,19 +552,7 @@ bool EDPSimple::processLocalWriterProxyData(RTPSWriter* local_writer, WriterProx
             wdata->writeToCDRMessage(&aux_msg, true);
             change->serializedPayload.length = (uint16_t)aux_msg.length;
 
-            {
-                std::unique_lock<std::recursive_timed_mutex> lock(*writer->second->getMutex());
-                for(auto ch = writer->second->changesBegin(); ch != writer->second->changesEnd(); ++ch)
-                {
-                    if((*ch)->instanceHandle == change->instanceHandle)
-                    {
-                        writer->second->remove_change(*ch);
-                        break;
-                    }
-                }
-            }
-
-            writer->second->add_change(change);
+            publishLocalProxyData(*writer, change);
 
             return true;
         }
@@ -584,6 +561,35 @@ bool EDPSimple::processLocalWriterProxyData(RTPSWriter* local_writer, WriterProx
     return true;
 }
 
+void EDPSimple::publishLocalProxyData(t_p_StatefulWriter& writer, CacheChange_t* change)
+{
+    {
+        std::unique_lock<std::recursive_timed_mutex> lock(*writer.second->getMutex());
+        for(auto ch = writer.second->changesBegin(); ch != writer.second->changesEnd(); ++ch)
+        {
+            if((*ch)->instanceHandle == change->instanceHandle)
+            {
+                // An update that does not modify the announced data is not sent again. Matched readers already
+                // have the previous announcement, and late joiners receive it from the history.
+                if((*ch)->kind == ALIVE &&
+                        (*ch)->serializedPayload.length == change->serializedPayload.length &&
+                        memcmp((*ch)->serializedPayload.data, change->serializedPayload.data,
+                            change->serializedPayload.length) == 0)
+                {
+                    logInfo(RTPS_EDP, "Announcement of " << change->instanceHandle << " did not change");
+                    writer.second->release_Cache(change);
+                    return;
+                }
+
+                writer.second->remove_change(*ch);
+                break;
+            }
+        }
+    }
+
+    writer.second->add_change(change);
+}
+
 bool EDPSimple::removeLocalWriter(RTPSWriter* W)
 {
     logInfo(RTPS_EDP,W->getGuid().entityId);
@@ -0,0 +1,209 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPServer.cpp
+ *
+ */
+
+#include <fastrtps/rtps/builtin/discovery/participant/PDPServer.h>
+
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/writer/StatelessWriter.h>
+
+#include "../../../participant/RTPSParticipantImpl.h"
+
+#include <fastrtps/log/Log.h>
+
+#include <chrono>
+
+using namespace eprosima::fastrtps;
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+PDPServer::PDPServer(BuiltinProtocols* built):
+    PDPSimple(built),
+    m_relayChange(DISCOVERY_PARTICIPANT_DATA_MAX_SIZE),
+    m_relayMessage(RTPSMESSAGE_DEFAULT_SIZE)
+    {
+
+    }
+
+PDPServer::~PDPServer()
+{
+}
+
+void PDPServer::announceParticipantState(bool new_change, bool dispose)
+{
+    PDPSimple::announceParticipantState(new_change, dispose);
+
+    // Each announcement period retries the relays. Clients drop the ones they already received.
+    if(!dispose)
+    {
+        std::lock_guard<std::recursive_mutex> guardPDP(*getMutex());
+        for(const auto& introduced : m_introducedClients)
+        {
+            relayToIntroducedClients(introduced.first);
+        }
+    }
+}
+
+void PDPServer::remoteParticipantDataReceived(ParticipantProxyData* pdata, const SequenceNumber_t& sequence_number)
+{
+    m_clientSequenceNumbers[pdata->m_guid.guidPrefix] = sequence_number;
+
+    // Clients already introduced get the new data too.
+    relayToIntroducedClients(pdata->m_guid.guidPrefix);
+}
+
+void PDPServer::readerProxyDataAdded(ReaderProxyData* rdata)
+{
+    for(WriterProxyData* wdata : topic_writers(rdata->topicName().c_str()))
+    {
+        introduceClients(rdata->guid().guidPrefix, wdata->guid().guidPrefix);
+    }
+}
+
+void PDPServer::writerProxyDataAdded(WriterProxyData* wdata)
+{
+    for(ReaderProxyData* rdata : topic_readers(wdata->topicName().c_str()))
+    {
+        introduceClients(wdata->guid().guidPrefix, rdata->guid().guidPrefix);
+    }
+}
+
+void PDPServer::participantProxyDataRemoved(ParticipantProxyData* pdata)
+{
+    const GuidPrefix_t& client = pdata->m_guid.guidPrefix;
+    m_clientSequenceNumbers.erase(client);
+
+    auto it = m_introducedClients.find(client);
+    if(it != m_introducedClients.end())
+    {
+        for(const GuidPrefix_t& peer : it->second)
+        {
+            auto peer_it = m_introducedClients.find(peer);
+            if(peer_it != m_introducedClients.end())
+            {
+                peer_it->second.erase(client);
+            }
+        }
+        m_introducedClients.erase(it);
+    }
+}
+
+void PDPServer::introduceClients(const GuidPrefix_t& first, const GuidPrefix_t& second)
+{
+    // Endpoints of the same client, or of the server itself, are not introduced.
+    const GuidPrefix_t& local = getRTPSParticipant()->getGuid().guidPrefix;
+    if(first == second || first == local || second == local)
+    {
+        return;
+    }
+
+    ParticipantProxyData* first_data = findParticipantProxy(first);
+    ParticipantProxyData* second_data = findParticipantProxy(second);
+    if(first_data == nullptr || second_data == nullptr ||
+            !m_introducedClients[first].insert(second).second)
+    {
+        return;
+    }
+    m_introducedClients[second].insert(first);
+
+    logInfo(RTPS_PDP, "Introducing RTPSParticipants " << first << " and " << second);
+    relayParticipantData(*first_data, *second_data);
+    relayParticipantData(*second_data, *first_data);
+}
+
+void PDPServer::relayToIntroducedClients(const GuidPrefix_t& client)
+{
+    auto it = m_introducedClients.find(client);
+    if(it == m_introducedClients.end())
+    {
+        return;
+    }
+
+    ParticipantProxyData* pdata = findParticipantProxy(client);
+    if(pdata == nullptr)
+    {
+        return;
+    }
+
+    for(const GuidPrefix_t& peer : it->second)
+    {
+        ParticipantProxyData* peer_data = findParticipantProxy(peer);
+        if(peer_data != nullptr)
+        {
+            relayParticipantData(*pdata, *peer_data);
+        }
+    }
+}
+
+void PDPServer::relayParticipantData(ParticipantProxyData& pdata, const ParticipantProxyData& destination)
+{
+    auto seq_it = m_clientSequenceNumbers.find(pdata.m_guid.guidPrefix);
+    if(seq_it == m_clientSequenceNumbers.end())
+    {
+        return;
+    }
+
+    // The change keeps the identity of the SPDP data sent by the client, so the destination handles it as
+    // if it had been received directly from the client.
+    m_relayChange.kind = ALIVE;
+    m_relayChange.writerGUID = GUID_t(pdata.m_guid.guidPrefix, c_EntityId_SPDPWriter);
+    m_relayChange.sequenceNumber = seq_it->second;
+    m_relayChange.instanceHandle = pdata.m_key;
+
+    CDRMessage_t aux_msg(m_relayChange.serializedPayload);
+
+#if __BIG_ENDIAN__
+    m_relayChange.serializedPayload.encapsulation = (uint16_t)PL_CDR_BE;
+    aux_msg.msg_endian = BIGEND;
+#else
+    m_relayChange.serializedPayload.encapsulation = (uint16_t)PL_CDR_LE;
+    aux_msg.msg_endian =  LITTLEEND;
+#endif
+
+    if(!pdata.writeToCDRMessage(&aux_msg, true))
+    {
+        logError(RTPS_PDP, "Cannot serialize ParticipantProxyData.");
+        return;
+    }
+    m_relayChange.serializedPayload.length = (uint16_t)aux_msg.length;
+
+    // INFO_SRC makes the DATA submessage come from the client being introduced.
+    CDRMessage::initCDRMsg(&m_relayMessage);
+    RTPSMessageCreator::addHeader(&m_relayMessage, getRTPSParticipant()->getGuid().guidPrefix);
+    RTPSMessageCreator::addSubmessageInfoSRC(&m_relayMessage, pdata.m_protocolVersion, pdata.m_VendorId,
+            pdata.m_guid.guidPrefix);
+    RTPSMessageCreator::addSubmessageData(&m_relayMessage, &m_relayChange, WITH_KEY, c_EntityId_SPDPReader,
+            false, nullptr);
+    m_relayMessage.length = m_relayMessage.pos;
+
+    const LocatorList_t& locators = destination.m_metatrafficUnicastLocatorList.empty() ?
+        destination.m_metatrafficMulticastLocatorList : destination.m_metatrafficUnicastLocatorList;
+    NetworkBufferList buffers(1, NetworkBuffer(m_relayMessage.buffer, m_relayMessage.length));
+    std::chrono::steady_clock::time_point max_blocking_time = std::chrono::steady_clock::now() +
+        std::chrono::hours(24);
+    getRTPSParticipant()->sendSync(buffers, m_relayMessage.length, getSPDPWriter(), locators, max_blocking_time);
+}
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
@@ -53,6 +53,7 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -61,6 +62,21 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+//! Removes an endpoint from the index of the endpoints of its topic.
+//! Empty topics are kept, so the references returned by topic_readers and topic_writers remain valid.
+template<typename ProxyData>
+static void remove_from_topic_index(
+        std::unordered_map<std::string, std::vector<ProxyData*>>& index,
+        ProxyData* data)
+{
+    auto it = index.find(data->topicName().c_str());
+    if(it != index.end())
+    {
+        std::vector<ProxyData*>& proxies = it->second;
+        proxies.erase(std::remove(proxies.begin(), proxies.end(), data), proxies.end());
+    }
+}
+
 
 PDPSimple::PDPSimple(BuiltinProtocols* built):
     mp_builtin(built),
@@ -226,6 +242,7 @@ bool PDPSimple::initPDP(RTPSParticipantImpl* part)
     mp_builtin->updateMetatrafficLocators(this->mp_SPDPReader->getAttributes().unicastLocatorList);
     m_participantProxies.push_back(new ParticipantProxyData());
     initializeParticipantProxyData(m_participantProxies.front());
+    registerParticipantProxy(m_participantProxies.front());
 
     //INIT EDP
     if(m_discovery.use_STATIC_EndpointDiscoveryProtocol)
@@ -283,7 +300,11 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
         {
             this->mp_mutex->lock();
             ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
-            local_participant_data->m_manualLivelinessCount++;
+            {
+                std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+                local_participant_data->m_manualLivelinessCount++;
+            }
+            m_localParticipantSerialized.length = 0;
             InstanceHandle_t key = local_participant_data->m_key;
             ParticipantProxyData proxy_data_copy(*local_participant_data);
             this->mp_mutex->unlock();
@@ -361,19 +382,16 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
 
 bool PDPSimple::lookupReaderProxyData(const GUID_t& reader, ReaderProxyData& rdata, ParticipantProxyData& pdata)
 {
-    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end();++pit)
+    RegistrySharedLock guardRegistry(m_registryMutex);
+    auto rit = m_readersByGuid.find(reader);
+    if(rit != m_readersByGuid.end())
     {
-        for (auto rit = (*pit)->m_readers.begin();
-                rit != (*pit)->m_readers.end();++rit)
+        ParticipantProxyData* participant = findParticipantProxy(reader.guidPrefix);
+        if(participant != nullptr)
         {
-            if((*rit)->guid() == reader)
-            {
-                rdata.copy(*rit);
-                pdata.copy(**pit);
-                return true;
-            }
+            rdata.copy(rit->second);
+            pdata.copy(*participant);
+            return true;
         }
     }
     return false;
@@ -381,56 +399,72 @@ bool PDPSimple::lookupReaderProxyData(const GUID_t& reader, ReaderProxyData& rda
 
 bool PDPSimple::lookupWriterProxyData(const GUID_t& writer, WriterProxyData& wdata, ParticipantProxyData& pdata)
 {
-    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    RegistrySharedLock guardRegistry(m_registryMutex);
+    auto wit = m_writersByGuid.find(writer);
+    if(wit != m_writersByGuid.end())
     {
-        for (auto wit = (*pit)->m_writers.begin();
-                wit != (*pit)->m_writers.end(); ++wit)
+        ParticipantProxyData* participant = findParticipantProxy(writer.guidPrefix);
+        if(participant != nullptr)
         {
-            if((*wit)->guid() == writer)
-            {
-                wdata.copy(*wit);
-                pdata.copy(**pit);
-                return true;
-            }
+            wdata.copy(wit->second);
+            pdata.copy(*participant);
+            return true;
         }
     }
     return false;
 }
 
+const std::vector<ReaderProxyData*>& PDPSimple::topic_readers(const std::string& topic_name) const
+{
+    static const std::vector<ReaderProxyData*> no_readers;
+
+    auto it = m_topicReaders.find(topic_name);
+    return it != m_topicReaders.end() ? it->second : no_readers;
+}
+
+const std::vector<WriterProxyData*>& PDPSimple::topic_writers(const std::string& topic_name) const
+{
+    static const std::vector<WriterProxyData*> no_writers;
+
+    auto it = m_topicWriters.find(topic_name);
+    return it != m_topicWriters.end() ? it->second : no_writers;
+}
+
 bool PDPSimple::removeReaderProxyData(const GUID_t& reader_guid)
 {
     logInfo(RTPS_PDP, "Removing reader proxy data " << reader_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    auto rit = m_readersByGuid.find(reader_guid);
+    ParticipantProxyData* participant = findParticipantProxy(reader_guid.guidPrefix);
+    if(rit == m_readersByGuid.end() || participant == nullptr)
     {
-        for (auto rit = (*pit)->m_readers.begin();
-                rit != (*pit)->m_readers.end(); ++rit)
-        {
-            if((*rit)->guid() == reader_guid)
-            {
-                mp_EDP->unpairReaderProxy((*pit)->m_guid, reader_guid);
+        return false;
+    }
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if(listener)
-                {
-                    ReaderDiscoveryInfo info;
-                    info.status = ReaderDiscoveryInfo::REMOVED_READER;
-                    info.info = std::move(**rit);
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+    ReaderProxyData* rdata = rit->second;
+    {
+        // Unindexed first, so lookups do not see it while its data is moved to the listener
+        std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+        m_readersByGuid.erase(rit);
+    }
+    mp_EDP->unpairReaderProxy(participant->m_guid, reader_guid);
 
-                delete *rit;
-                (*pit)->m_readers.erase(rit);
-                return true;
-            }
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        ReaderDiscoveryInfo info;
+        info.status = ReaderDiscoveryInfo::REMOVED_READER;
+        info.info = std::move(*rdata);
+        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
 
-    return false;
+    remove_from_topic_index(m_topicReaders, rdata);
+    participant->m_readers.erase(
+            std::remove(participant->m_readers.begin(), participant->m_readers.end(), rdata),
+            participant->m_readers.end());
+    delete rdata;
+    return true;
 }
 
 bool PDPSimple::removeWriterProxyData(const GUID_t& writer_guid)
@@ -438,52 +472,77 @@ bool PDPSimple::removeWriterProxyData(const GUID_t& writer_guid)
     logInfo(RTPS_PDP, "Removing writer proxy data " << writer_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (auto pit = m_participantProxies.begin();
-            pit != m_participantProxies.end(); ++pit)
+    auto wit = m_writersByGuid.find(writer_guid);
+    ParticipantProxyData* participant = findParticipantProxy(writer_guid.guidPrefix);
+    if(wit == m_writersByGuid.end() || participant == nullptr)
     {
-        for (auto wit = (*pit)->m_writers.begin();
-                wit != (*pit)->m_writers.end(); ++wit)
-        {
-            if((*wit)->guid() == writer_guid)
-            {
-                mp_EDP->unpairWriterProxy((*pit)->m_guid, writer_guid);
+        return false;
+    }
 
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if(listener)
-                {
-                    WriterDiscoveryInfo info;
-                    info.status = WriterDiscoveryInfo::REMOVED_WRITER;
-                    info.info = std::move(**wit);
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+    WriterProxyData* wdata = wit->second;
+    {
+        // Unindexed first, so lookups do not see it while its data is moved to the listener
+        std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+        m_writersByGuid.erase(wit);
+    }
+    mp_EDP->unpairWriterProxy(participant->m_guid, writer_guid);
 
-                delete *wit;
-                (*pit)->m_writers.erase(wit);
-                return true;
-            }
-        }
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        WriterDiscoveryInfo info;
+        info.status = WriterDiscoveryInfo::REMOVED_WRITER;
+        info.info = std::move(*wdata);
+        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
     }
 
-    return false;
+    remove_from_topic_index(m_topicWriters, wdata);
+    participant->m_writers.erase(
+            std::remove(participant->m_writers.begin(), participant->m_writers.end(), wdata),
+            participant->m_writers.end());
+    delete wdata;
+    return true;
 }
 
 
 bool PDPSimple::lookupParticipantProxyData(const GUID_t& pguid, ParticipantProxyData& pdata)
 {
     logInfo(RTPS_PDP,pguid);
-    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    RegistrySharedLock guardRegistry(m_registryMutex);
+    ParticipantProxyData* participant = findParticipantProxy(pguid.guidPrefix);
+    if(participant != nullptr && participant->m_guid == pguid)
     {
-        if((*pit)->m_guid == pguid)
-        {
-            pdata.copy(**pit);
-            return true;
-        }
+        pdata.copy(*participant);
+        return true;
     }
     return false;
 }
 
+void PDPSimple::registerParticipantProxy(ParticipantProxyData* pdata)
+{
+    std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+    m_participantsByPrefix[pdata->m_guid.guidPrefix] = pdata;
+}
+
+void PDPSimple::unregisterParticipantProxy(ParticipantProxyData* pdata)
+{
+    m_participantsByPrefix.erase(pdata->m_guid.guidPrefix);
+    for(ReaderProxyData* rdata : pdata->m_readers)
+    {
+        m_readersByGuid.erase(rdata->guid());
+    }
+    for(WriterProxyData* wdata : pdata->m_writers)
+    {
+        m_writersByGuid.erase(wdata->guid());
+    }
+}
+
+ParticipantProxyData* PDPSimple::findParticipantProxy(const GuidPrefix_t& guidP) const
+{
+    auto pit = m_participantsByPrefix.find(guidP);
+    return pit != m_participantsByPrefix.end() ? pit->second : nullptr;
+}
+
 bool PDPSimple::createSPDPEndpoints()
 {
     logInfo(RTPS_PDP,"Beginning");
@@ -590,61 +649,64 @@ bool PDPSimple::addReaderProxyData(ReaderProxyData* rdata, ParticipantProxyData&
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxy(rdata->guid().guidPrefix);
+    if(participant == nullptr)
     {
-        if((*pit)->m_guid.guidPrefix == rdata->guid().guidPrefix)
-        {
-            // Set locators information if not defined by ReaderProxyData.
-            if(rdata->unicastLocatorList().empty() && rdata->multicastLocatorList().empty())
-            {
-                rdata->unicastLocatorList((*pit)->m_defaultUnicastLocatorList);
-                rdata->multicastLocatorList((*pit)->m_defaultMulticastLocatorList);
-            }
-            // Set as alive.
-            rdata->isAlive(true);
-
-            // Copy participant data to be used outside.
-            pdata.copy(**pit);
+        return false;
+    }
 
-            // Check that it is not already there:
-            for(std::vector<ReaderProxyData*>::iterator rit = (*pit)->m_readers.begin();
-                    rit!=(*pit)->m_readers.end();++rit)
-            {
-                if((*rit)->guid().entityId == rdata->guid().entityId)
-                {
-                    (*rit)->update(rdata);
-
-                    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                    if(listener)
-                    {
-                        ReaderDiscoveryInfo info;
-                        info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
-                        info.info = *rdata;
-                        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    }
-
-                    return true;
-                }
-            }
+    // Set locators information if not defined by ReaderProxyData.
+    if(rdata->unicastLocatorList().empty() && rdata->multicastLocatorList().empty())
+    {
+        rdata->unicastLocatorList(participant->m_defaultUnicastLocatorList);
+        rdata->multicastLocatorList(participant->m_defaultMulticastLocatorList);
+    }
+    // Set as alive.
+    rdata->isAlive(true);
 
-            ReaderProxyData* newRPD = new ReaderProxyData(*rdata);
-            (*pit)->m_readers.push_back(newRPD);
+    // Copy participant data to be used outside.
+    pdata.copy(*participant);
 
-            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-            if(listener)
-            {
-                ReaderDiscoveryInfo info;
-                info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
-                info.info = *rdata;
-                listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-            }
+    // Check that it is not already there:
+    auto rit = m_readersByGuid.find(rdata->guid());
+    if(rit != m_readersByGuid.end())
+    {
+        {
+            std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+            rit->second->update(rdata);
+        }
 
-            return true;
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if(listener)
+        {
+            ReaderDiscoveryInfo info;
+            info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
+            info.info = *rdata;
+            listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
         }
+
+        return true;
     }
 
-    return false;
+    ReaderProxyData* newRPD = new ReaderProxyData(*rdata);
+    participant->m_readers.push_back(newRPD);
+    m_topicReaders[newRPD->topicName().c_str()].push_back(newRPD);
+    {
+        std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+        m_readersByGuid[newRPD->guid()] = newRPD;
+    }
+    readerProxyDataAdded(newRPD);
+
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        ReaderDiscoveryInfo info;
+        info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+        info.info = *rdata;
+        listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+    }
+
+    return true;
 }
 
 bool PDPSimple::addWriterProxyData(WriterProxyData* wdata, ParticipantProxyData& pdata)
@@ -653,58 +715,62 @@ bool PDPSimple::addWriterProxyData(WriterProxyData* wdata, ParticipantProxyData&
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxy(wdata->guid().guidPrefix);
+    if(participant == nullptr)
     {
-        if((*pit)->m_guid.guidPrefix == wdata->guid().guidPrefix)
-        {
-            // Set locators information if not defined by ReaderProxyData.
-            if(wdata->unicastLocatorList().empty() && wdata->multicastLocatorList().empty())
-            {
-                wdata->unicastLocatorList((*pit)->m_defaultUnicastLocatorList);
-                wdata->multicastLocatorList((*pit)->m_defaultMulticastLocatorList);
-            }
-
-            // Copy participant data to be used outside.
-            pdata.copy(**pit);
+        return false;
+    }
 
-            //CHECK THAT IT IS NOT ALREADY THERE:
-            for(std::vector<WriterProxyData*>::iterator wit = (*pit)->m_writers.begin();
-                    wit!=(*pit)->m_writers.end();++wit)
-            {
-                if((*wit)->guid().entityId == wdata->guid().entityId)
-                {
-                    (*wit)->update(wdata);
-
-                    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                    if(listener)
-                    {
-                        WriterDiscoveryInfo info;
-                        info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
-                        info.info = *wdata;
-                        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    }
-
-                    return true;
-                }
-            }
+    // Set locators information if not defined by ReaderProxyData.
+    if(wdata->unicastLocatorList().empty() && wdata->multicastLocatorList().empty())
+    {
+        wdata->unicastLocatorList(participant->m_defaultUnicastLocatorList);
+        wdata->multicastLocatorList(participant->m_defaultMulticastLocatorList);
+    }
 
-            WriterProxyData* newWPD = new WriterProxyData(*wdata);
-            (*pit)->m_writers.push_back(newWPD);
+    // Copy participant data to be used outside.
+    pdata.copy(*participant);
 
-            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-            if(listener)
-            {
-                WriterDiscoveryInfo info;
-                info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
-                info.info = *wdata;
-                listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-            }
+    //CHECK THAT IT IS NOT ALREADY THERE:
+    auto wit = m_writersByGuid.find(wdata->guid());
+    if(wit != m_writersByGuid.end())
+    {
+        {
+            std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+            wit->second->update(wdata);
+        }
 
-            return true;
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if(listener)
+        {
+            WriterDiscoveryInfo info;
+            info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
+            info.info = *wdata;
+            listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
         }
+
+        return true;
     }
-    return false;
+
+    WriterProxyData* newWPD = new WriterProxyData(*wdata);
+    participant->m_writers.push_back(newWPD);
+    m_topicWriters[newWPD->topicName().c_str()].push_back(newWPD);
+    {
+        std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+        m_writersByGuid[newWPD->guid()] = newWPD;
+    }
+    writerProxyDataAdded(newWPD);
+
+    RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+    if(listener)
+    {
+        WriterDiscoveryInfo info;
+        info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+        info.info = *wdata;
+        listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+    }
+
+    return true;
 }
 
 void PDPSimple::assignRemoteEndpoints(ParticipantProxyData* pdata)
@@ -797,23 +863,40 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
 {
     logInfo(RTPS_PDP,partGUID );
     ParticipantProxyData* pdata = nullptr;
+    RemoteParticipantLeaseDuration* lease_timer = nullptr;
 
     //Remove it from our vector or RTPSParticipantProxies:
     this->mp_mutex->lock();
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    ParticipantProxyData* participant = findParticipantProxy(partGUID.guidPrefix);
+    if(participant != nullptr && participant->m_guid == partGUID)
     {
-        if((*pit)->m_guid == partGUID)
+        pdata = participant;
+        m_participantProxies.erase(std::find(m_participantProxies.begin(), m_participantProxies.end(), pdata));
+        {
+            // The timer is detached with the participant, so assertRemoteParticipantLiveliness cannot reach it
+            // once it is destroyed.
+            std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+            unregisterParticipantProxy(pdata);
+            lease_timer = pdata->mp_leaseDurationTimer;
+            pdata->mp_leaseDurationTimer = nullptr;
+        }
+        participantProxyDataRemoved(pdata);
+        for(ReaderProxyData* rdata : pdata->m_readers)
+        {
+            remove_from_topic_index(m_topicReaders, rdata);
+        }
+        for(WriterProxyData* wdata : pdata->m_writers)
         {
-            pdata = *pit;
-            m_participantProxies.erase(pit);
-            break;
+            remove_from_topic_index(m_topicWriters, wdata);
         }
     }
     this->mp_mutex->unlock();
 
     if(pdata !=nullptr)
     {
+        // Destroyed without locks, as it waits for a running callback, which takes them.
+        delete lease_timer;
+
         if(mp_EDP!=nullptr)
         {
             RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
@@ -876,21 +959,19 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
 
 void PDPSimple::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
 {
-    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator it = this->m_participantProxies.begin();
-            it!=this->m_participantProxies.end();++it)
-    {
-        if((*it)->m_guid.guidPrefix == guidP)
+    // Only the registry is locked, as this is called for every liveliness message received.
+    // It stays locked while the timer is used: removeRemoteParticipant unindexes the participant and
+    // detaches its timer in one critical section, so a timer found here is not destroyed meanwhile.
+    std::lock_guard<RegistryMutex> guardRegistry(m_registryMutex);
+    ParticipantProxyData* pdata = findParticipantProxy(guidP);
+    if(pdata != nullptr)
+    {
+        logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< pdata->m_guid << " is Alive");
+        // isAlive is already set when the participant is added or updated.
+        if(pdata->mp_leaseDurationTimer != nullptr)
         {
-            logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< (*it)->m_guid << " is Alive");
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            (*it)->isAlive = true;
-            if((*it)->mp_leaseDurationTimer != nullptr)
-            {
-                (*it)->mp_leaseDurationTimer->cancel_timer();
-                (*it)->mp_leaseDurationTimer->restart_timer();
-            }
-            break;
+            pdata->mp_leaseDurationTimer->cancel_timer();
+            pdata->mp_leaseDurationTimer->restart_timer();
         }
     }
 }
@@ -911,16 +992,23 @@ bool PDPSimple::newRemoteEndpointStaticallyDiscovered(const GUID_t& pguid, int16
 CDRMessage_t PDPSimple::get_participant_proxy_data_serialized(Endianness_t endian)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    CDRMessage_t cdr_msg;
-    cdr_msg.msg_endian = endian;
 
-    if (!getLocalParticipantProxyData()->writeToCDRMessage(&cdr_msg, false))
+    // Each handshake with a remote participant asks for the same data, so it is only serialized again when the
+    // local data changed.
+    if (m_localParticipantSerialized.length == 0 || m_localParticipantSerialized.msg_endian != endian)
     {
-        cdr_msg.pos = 0;
-        cdr_msg.length = 0;
+        m_localParticipantSerialized.pos = 0;
+        m_localParticipantSerialized.length = 0;
+        m_localParticipantSerialized.msg_endian = endian;
+
+        if (!getLocalParticipantProxyData()->writeToCDRMessage(&m_localParticipantSerialized, false))
+        {
+            m_localParticipantSerialized.pos = 0;
+            m_localParticipantSerialized.length = 0;
+        }
     }
 
-    return cdr_msg;
+    return m_localParticipantSerialized;
 }
 
 } /* namespace rtps */
@@ -78,17 +78,8 @@ void PDPSimpleListener::onNewCacheChangeAdded(
             reader->getMutex().unlock();
 
             //LOOK IF IS AN UPDATED INFORMATION
-            ParticipantProxyData* pdata = nullptr;
             std::unique_lock<std::recursive_mutex> lock(*mp_SPDP->getMutex());
-            for (auto it = mp_SPDP->m_participantProxies.begin();
-                    it != mp_SPDP->m_participantProxies.end();++it)
-            {
-                if(participant_data.m_key == (*it)->m_key)
-                {
-                    pdata = (*it);
-                    break;
-                }
-            }
+            ParticipantProxyData* pdata = mp_SPDP->findParticipantProxy(participant_data.m_guid.guidPrefix);
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
                 ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT;
@@ -103,6 +94,8 @@ void PDPSimpleListener::onNewCacheChangeAdded(
                         TimeConv::Duration_t2MilliSecondsDouble(pdata->m_leaseDuration));
                 pdata->mp_leaseDurationTimer->restart_timer();
                 this->mp_SPDP->m_participantProxies.push_back(pdata);
+                this->mp_SPDP->registerParticipantProxy(pdata);
+                this->mp_SPDP->remoteParticipantDataReceived(pdata, change->sequenceNumber);
                 lock.unlock();
 
                 mp_SPDP->announceParticipantState(false);
@@ -110,8 +103,13 @@ void PDPSimpleListener::onNewCacheChangeAdded(
             }
             else
             {
-                pdata->updateData(participant_data);
-                pdata->isAlive = true;
+                {
+                    // The contents and the lease timer are guarded by the registry.
+                    std::lock_guard<PDPSimple::RegistryMutex> guardRegistry(mp_SPDP->m_registryMutex);
+                    pdata->updateData(participant_data);
+                    pdata->isAlive = true;
+                }
+                this->mp_SPDP->remoteParticipantDataReceived(pdata, change->sequenceNumber);
                 lock.unlock();
 
                 if(mp_SPDP->m_discovery.use_STATIC_EndpointDiscoveryProtocol)
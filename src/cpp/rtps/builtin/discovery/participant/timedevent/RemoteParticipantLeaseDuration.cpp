@@ -40,7 +40,7 @@ RemoteParticipantLeaseDuration::RemoteParticipantLeaseDuration(PDPSimple* p_SPDP
         ParticipantProxyData* pdata,
         double interval):
     TimedEvent(p_SPDP->getRTPSParticipant()->getEventResource().getIOService(),
-            p_SPDP->getRTPSParticipant()->getEventResource().getThread(), interval, TimedEvent::ON_SUCCESS),
+            p_SPDP->getRTPSParticipant()->getEventResource().getThread(), interval, TimedEvent::NONE),
     mp_PDP(p_SPDP),
     mp_participantProxyData(pdata)
     {
@@ -59,17 +59,32 @@ void RemoteParticipantLeaseDuration::event(EventCode code, const char* msg)
 
     if(code == EVENT_SUCCESS)
     {
-        logInfo(RTPS_LIVELINESS,"RTPSParticipant no longer ALIVE, trying to remove: "
-                << mp_participantProxyData->m_guid);
-
-        // This assignment must be before removeRemoteParticipant because mp_participantProxyData is deleted there.
+        GUID_t guid;
         ParticipantDiscoveryInfo info;
-        info.status = ParticipantDiscoveryInfo::DROPPED_PARTICIPANT;
-        info.info.copy(*mp_participantProxyData);
 
-        // Set pointer to null because this call will be delete itself.
-        mp_participantProxyData->mp_leaseDurationTimer = nullptr;
-        if(mp_PDP->removeRemoteParticipant(mp_participantProxyData->m_guid))
+        {
+            std::lock_guard<PDPSimple::RegistryMutex> guardRegistry(mp_PDP->m_registryMutex);
+
+            // A participant being removed by another thread has already detached this timer,
+            // and that thread destroys it.
+            if(mp_participantProxyData->mp_leaseDurationTimer != this)
+            {
+                return;
+            }
+
+            logInfo(RTPS_LIVELINESS,"RTPSParticipant no longer ALIVE, trying to remove: "
+                    << mp_participantProxyData->m_guid);
+
+            // Detached, so removeRemoteParticipant leaves the timer to this callback.
+            mp_participantProxyData->mp_leaseDurationTimer = nullptr;
+
+            // Copied before removeRemoteParticipant because mp_participantProxyData is deleted there.
+            guid = mp_participantProxyData->m_guid;
+            info.status = ParticipantDiscoveryInfo::DROPPED_PARTICIPANT;
+            info.info.copy(*mp_participantProxyData);
+        }
+
+        if(mp_PDP->removeRemoteParticipant(guid))
         {
             if(mp_PDP->getRTPSParticipant()->getListener()!=nullptr)
             {
@@ -77,6 +92,13 @@ void RemoteParticipantLeaseDuration::event(EventCode code, const char* msg)
                         mp_PDP->getRTPSParticipant()->getUserRTPSParticipant(), std::move(info));
             }
         }
+
+        // Destroyed on the event thread once this callback has returned.
+        RemoteParticipantLeaseDuration* timer = this;
+        mp_PDP->getRTPSParticipant()->getEventResource().getIOService().post([timer]()
+        {
+            delete timer;
+        });
     }
     else if(code == EVENT_ABORT)
     {
@@ -25,6 +25,8 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <mutex>
+
 
 namespace eprosima {
 namespace fastrtps{
@@ -56,9 +58,11 @@ void ResendParticipantProxyDataPeriod::event(EventCode code, const char* msg)
     {
         logInfo(RTPS_PDP,"ResendDiscoveryData Period");
         //FIXME: Change for liveliness protocol
-        mp_PDP->getMutex()->lock();
-        mp_PDP->getLocalParticipantProxyData()->m_manualLivelinessCount++;
-        mp_PDP->getMutex()->unlock();
+        {
+            std::lock_guard<std::recursive_mutex> guardPDP(*mp_PDP->getMutex());
+            std::lock_guard<PDPSimple::RegistryMutex> guardRegistry(mp_PDP->m_registryMutex);
+            mp_PDP->getLocalParticipantProxyData()->m_manualLivelinessCount++;
+        }
         mp_PDP->announceParticipantState(false);
 
         this->restart_timer();
@@ -16,67 +16,108 @@
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 #include <asio.hpp>
 #include <asio/steady_timer.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 
 namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
+static const int32_t no_blocked_priority = std::numeric_limits<int32_t>::min();
+
 ThroughputController::ThroughputController(const ThroughputControllerDescriptor& descriptor, const RTPSWriter* associatedWriter):
-    mBytesPerPeriod(descriptor.bytesPerPeriod),
-    mAccumulatedPayloadSize(0),
-    mPeriodMillisecs(descriptor.periodMillisecs),
+    mBurstSize(std::max(descriptor.burstSize, descriptor.bytesPerPeriod)),
+    mBytesPerNanosec(static_cast<double>(descriptor.bytesPerPeriod) / (std::max(descriptor.periodMillisecs, 1u) * 1e6)),
+    mPeriod(std::chrono::milliseconds(std::max(descriptor.periodMillisecs, 1u))),
+    mAvailableBytes(mBurstSize),
+    mLastRefill(std::chrono::steady_clock::now()),
+    mBytesClearedInPeriod(0),
+    mBlockedPriority(no_blocked_priority),
     mAssociatedParticipant(nullptr),
-    mAssociatedWriter(associatedWriter)
+    mAssociatedWriter(associatedWriter),
+    mRefreshTimer(*FlowController::ControllerService),
+    mRefreshScheduled(false)
 {
 }
 
 ThroughputController::ThroughputController(const ThroughputControllerDescriptor& descriptor, const RTPSParticipantImpl* associatedParticipant):
-    mBytesPerPeriod(descriptor.bytesPerPeriod),
-    mAccumulatedPayloadSize(0),
-    mPeriodMillisecs(descriptor.periodMillisecs),
+    mBurstSize(std::max(descriptor.burstSize, descriptor.bytesPerPeriod)),
+    mBytesPerNanosec(static_cast<double>(descriptor.bytesPerPeriod) / (std::max(descriptor.periodMillisecs, 1u) * 1e6)),
+    mPeriod(std::chrono::milliseconds(std::max(descriptor.periodMillisecs, 1u))),
+    mAvailableBytes(mBurstSize),
+    mLastRefill(std::chrono::steady_clock::now()),
+    mBytesClearedInPeriod(0),
+    mBlockedPriority(no_blocked_priority),
     mAssociatedParticipant(associatedParticipant),
-    mAssociatedWriter(nullptr)
+    mAssociatedWriter(nullptr),
+    mRefreshTimer(*FlowController::ControllerService),
+    mRefreshScheduled(false)
 {
 }
 
-void ThroughputController::operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend)
+ThroughputController::~ThroughputController()
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    mRefreshTimer.cancel();
+}
 
-    auto it = changesToSend.items().begin();
-
-    while(it != changesToSend.items().end())
-    {
-        if(!process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber))
-            break;
-
-        ++it;
-    }
-
-    changesToSend.items().erase(it, changesToSend.items().end());
+void ThroughputController::operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    process_nts_(changesToSend);
 }
 
 void ThroughputController::operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend)
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    process_nts_(changesToSend);
+}
+
+template<class T>
+void ThroughputController::process_nts_(RTPSWriterCollector<T>& changesToSend)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    refill_nts_(now);
 
     auto it = changesToSend.items().begin();
+    int32_t priority = changesToSend.priority();
 
-    while(it != changesToSend.items().end())
+    if (priority >= mBlockedPriority)
     {
-        if(!process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber))
-            break;
+        while(it != changesToSend.items().end())
+        {
+            if(!process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber, now))
+                break;
 
-        ++it;
+            ++it;
+        }
+
+        if (it == changesToSend.items().end())
+        {
+            // Nobody with higher priority is waiting any more.
+            mBlockedPriority = no_blocked_priority;
+        }
+    }
+    else if (it != changesToSend.items().end())
+    {
+        // Held back in favour of a writer with higher priority. Wake up anyway when the bucket gets full, in case
+        // that writer does not come back.
+        ScheduleRefresh(static_cast<uint32_t>(mBurstSize));
+    }
+
+    if (it != changesToSend.items().end())
+    {
+        mBlockedPriority = std::max(mBlockedPriority, priority);
     }
 
     changesToSend.items().erase(it, changesToSend.items().end());
 }
 
 bool ThroughputController::process_change_nts_(CacheChange_t* change, const SequenceNumber_t& /*seqNum*/,
-        const FragmentNumber_t fragNum)
+        const FragmentNumber_t fragNum, std::chrono::steady_clock::time_point now)
 {
     assert(change != nullptr);
 
@@ -86,38 +127,100 @@ bool ThroughputController::process_change_nts_(CacheChange_t* change, const Sequ
         dataLength = (fragNum + 1) != change->getFragmentCount() ?
             change->getFragmentSize() : change->serializedPayload.length - (fragNum * change->getFragmentSize());
 
-    if((mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
+    // The bucket refills while it is being emptied, so it alone would let up to twice its capacity through in a
+    // period. The bytes cleared during the last period are bounded by the capacity too.
+    if(dataLength <= mAvailableBytes && mBytesClearedInPeriod + dataLength <= mBurstSize)
     {
-        mAccumulatedPayloadSize += dataLength;
-        ScheduleRefresh(dataLength);
+        mAvailableBytes -= dataLength;
+        mClearedInPeriod.emplace_back(now, dataLength);
+        mBytesClearedInPeriod += dataLength;
         return true;
     }
 
+    // Data bigger than the bucket would never be cleared.
+    if (dataLength <= mBurstSize)
+    {
+        ScheduleRefresh(dataLength);
+    }
+
     return false;
 }
 
-void ThroughputController::ScheduleRefresh(uint32_t sizeToRestore)
+void ThroughputController::refill_nts_(std::chrono::steady_clock::time_point now)
 {
-    std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(*FlowController::ControllerService));
-    auto refresh = [throwawayTimer, this, sizeToRestore]
-        (const asio::error_code& error)
+    while (!mClearedInPeriod.empty() && mClearedInPeriod.front().first + mPeriod <= now)
+    {
+        mBytesClearedInPeriod -= mClearedInPeriod.front().second;
+        mClearedInPeriod.pop_front();
+    }
+
+    if (now <= mLastRefill)
+    {
+        return;
+    }
+
+    double earned = std::chrono::duration<double, std::nano>(now - mLastRefill).count() * mBytesPerNanosec;
+    mLastRefill = now;
+    mAvailableBytes = std::min(mBurstSize, mAvailableBytes + earned);
+
+    if (mAvailableBytes >= mBurstSize)
+    {
+        // Whoever was waiting has had enough time to take the bytes.
+        mBlockedPriority = no_blocked_priority;
+    }
+}
+
+void ThroughputController::ScheduleRefresh(uint32_t bytesNeeded)
+{
+    if (mRefreshScheduled)
+    {
+        return;
+    }
+
+    double missingBytes = bytesNeeded > mAvailableBytes ? bytesNeeded - mAvailableBytes : 0.0;
+    // A zero rate never earns the missing bytes. Check again after a whole period instead of dividing by zero.
+    std::chrono::nanoseconds wait(mPeriod);
+    if (mBytesPerNanosec > 0.0)
+    {
+        wait = std::chrono::nanoseconds(static_cast<int64_t>(std::ceil(missingBytes / mBytesPerNanosec)));
+    }
+
+    // The bytes also have to fit in the current period, so wait for enough of the last cleared ones to leave it.
+    double excessBytes = mBytesClearedInPeriod + bytesNeeded - mBurstSize;
+    for (auto cleared = mClearedInPeriod.begin(); excessBytes > 0 && cleared != mClearedInPeriod.end(); ++cleared)
+    {
+        excessBytes -= cleared->second;
+        if (excessBytes <= 0)
+        {
+            std::chrono::nanoseconds windowWait = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    cleared->first + mPeriod - std::chrono::steady_clock::now());
+            wait = std::max(wait, windowWait);
+        }
+    }
+
+    auto refresh = [this](const asio::error_code& error)
         {
-            if ((error != asio::error::operation_aborted) &&
-                    FlowController::IsListening(this))
+            if (error != asio::error::operation_aborted)
             {
-                std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
-                throwawayTimer->cancel();
-                mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ? 0 : mAccumulatedPayloadSize - sizeToRestore;
-
-                if (mAssociatedWriter)
-                    AsyncWriterThread::wakeUp(mAssociatedWriter);
-                else if (mAssociatedParticipant)
-                    AsyncWriterThread::wakeUp(mAssociatedParticipant);
+                // Cleared even when nobody is listening, so later held back changes can arm the timer again.
+                {
+                    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+                    mRefreshScheduled = false;
+                }
+
+                if (FlowController::IsListening(this))
+                {
+                    if (mAssociatedWriter)
+                        AsyncWriterThread::wakeUp(mAssociatedWriter);
+                    else if (mAssociatedParticipant)
+                        AsyncWriterThread::wakeUp(mAssociatedParticipant);
+                }
             }
         };
 
-    throwawayTimer->expires_from_now(std::chrono::milliseconds(mPeriodMillisecs));
-    throwawayTimer->async_wait(refresh);
+    mRefreshScheduled = true;
+    mRefreshTimer.expires_from_now(wait);
+    mRefreshTimer.async_wait(refresh);
 }
 
 } // namespace rtps
@@ -18,7 +18,11 @@
 #include "FlowController.h"
 #include <fastrtps/rtps/flowcontrol/ThroughputControllerDescriptor.h>
 
+#include <asio/steady_timer.hpp>
+#include <chrono>
+#include <deque>
 #include <thread>
+#include <utility>
 
 namespace eprosima{
 namespace fastrtps{
@@ -28,10 +32,12 @@ class RTPSWriter;
 class RTPSParticipantImpl;
 
 /**
- * Simple filter that only clears changes up to a certain accumulated payload size.
- * It refreshes after a given time in MS, in a staggered way (e.g. if it clears
- * 500kb at t=0 and 800 kb at t=10, it will refresh 500kb at t = 0 + period, and
- * then fully refresh at t = 10 + period).
+ * Token bucket filter that only clears changes while there are enough bytes in the bucket.
+ * The bucket is refilled at a rate of 'bytesPerPeriod' bytes every 'periodMillisecs', up to 'burstSize' bytes.
+ * Refilling is computed from the elapsed time each time the controller is used, so a single timer is armed, and only
+ * when changes are held back, to wake the writers up once the bucket has enough bytes for them.
+ * The bytes cleared during the last period are also tracked, so no window of 'periodMillisecs' carries more than the
+ * capacity of the bucket, which is 'bytesPerPeriod' unless a bigger 'burstSize' is configured.
  */
 class ThroughputController : public FlowController
 {
@@ -39,27 +45,50 @@ public:
    ThroughputController(const ThroughputControllerDescriptor&, const RTPSWriter* associatedWriter);
    ThroughputController(const ThroughputControllerDescriptor&, const RTPSParticipantImpl* associatedParticipant);
 
+   virtual ~ThroughputController();
+
    virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend);
    virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend);
 
 private:
 
+   template<class T>
+   void process_nts_(RTPSWriterCollector<T>& changesToSend);
+
    bool process_change_nts_(CacheChange_t* change, const SequenceNumber_t& seqNum,
-        const FragmentNumber_t fragNum);
+        const FragmentNumber_t fragNum, std::chrono::steady_clock::time_point now);
 
-   uint32_t mBytesPerPeriod;
-   uint32_t mAccumulatedPayloadSize;
-   uint32_t mPeriodMillisecs;
+   //! Adds to the bucket the bytes earned since the last refill, and forgets the bytes cleared over a period ago.
+   void refill_nts_(std::chrono::steady_clock::time_point now);
+
+   //! Capacity of the bucket, in bytes.
+   double mBurstSize;
+   //! Bytes earned per nanosecond.
+   double mBytesPerNanosec;
+   //! Length of a period. Used as the retry interval when the rate is zero.
+   std::chrono::nanoseconds mPeriod;
+   //! Bytes currently in the bucket.
+   double mAvailableBytes;
+   std::chrono::steady_clock::time_point mLastRefill;
+   //! Bytes cleared during the last period, with the time they were cleared, oldest first.
+   std::deque<std::pair<std::chrono::steady_clock::time_point, uint32_t>> mClearedInPeriod;
+   //! Sum of the bytes in mClearedInPeriod.
+   double mBytesClearedInPeriod;
+   //! Highest priority of the writers waiting for the bucket to be refilled.
+   int32_t mBlockedPriority;
    std::recursive_mutex mThroughputControllerMutex;
 
    const RTPSParticipantImpl* mAssociatedParticipant;
    const RTPSWriter* mAssociatedWriter;
 
+   asio::steady_timer mRefreshTimer;
+   bool mRefreshScheduled;
+
    /*
-    * Schedules the filter to be refreshed in period ms. When it does, its capacity
-    * will be partially restored, by "sizeToRestore" bytes.
+    * Arms the timer, unless it is already armed, to wake the writers up when the bucket has
+    * "bytesNeeded" bytes.
     */
-   void ScheduleRefresh(uint32_t sizeToRestore);
+   void ScheduleRefresh(uint32_t bytesNeeded);
 };
 
 } // namespace rtps
@@ -24,17 +24,70 @@
 #include <mutex>
 
 #include <cassert>
+#include <cstdlib>
+#include <new>
 
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+//! Alignment of the CacheChanges allocated on DYNAMIC_REUSABLE_MEMORY_MODE.
+static const size_t change_alignment = 64;
+
+//! Distance between consecutive CacheChanges in a block, so each one starts on its own cache line.
+static const size_t change_stride = (sizeof(CacheChange_t) + change_alignment - 1) & ~(change_alignment - 1);
+
+//! Number of payload size classes. Class i holds buffers of at least 2^i bytes.
+static const size_t payload_classes = 33;
+
+//! Smallest size class whose buffers can hold size bytes.
+static inline uint32_t payload_class_for(uint32_t size)
+{
+    uint32_t size_class = 0;
+    while (size_class < 32 && (1ULL << size_class) < size)
+    {
+        ++size_class;
+    }
+    return size_class;
+}
+
+//! Size class a buffer of max_size bytes is kept in.
+static inline uint32_t payload_class_of(uint32_t max_size)
+{
+    uint32_t size_class = 0;
+    while ((1ULL << (size_class + 1)) <= max_size)
+    {
+        ++size_class;
+    }
+    return size_class;
+}
 
 CacheChangePool::~CacheChangePool()
 {
     logInfo(RTPS_UTILS,"ChangePool destructor");
-    //Deletion process does not depend on the memory management policy
+
+    if(memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE)
+    {
+        // Changes were constructed in place inside the blocks
+        for(CacheChange_t* ch : m_allCaches)
+        {
+            ch->~CacheChange_t();
+        }
+        for(void* block : m_changeBlocks)
+        {
+            free(block);
+        }
+        for(std::vector<FreePayload>& free_payloads : m_freePayloads)
+        {
+            for(FreePayload& payload : free_payloads)
+            {
+                free(payload.data);
+            }
+        }
+        return;
+    }
+
     for(std::vector<CacheChange_t*>::iterator it = m_allCaches.begin();it!=m_allCaches.end();++it)
     {
         delete(*it);
@@ -76,6 +129,11 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
         case DYNAMIC_RESERVE_MEMORY_MODE:
             logInfo(RTPS_UTILS,"Dynamic Mode is active, CacheChanges are allocated on request");
             break;
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            logInfo(RTPS_UTILS,"Dynamic Reusable Mode is active, preallocating pool_size CacheChanges. Payloads are allocated on request and reused");
+            m_freePayloads.resize(payload_classes);
+            allocateGroup(pool_size);
+            break;
     }
 }
 
@@ -141,6 +199,23 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
             *chan = allocateSingle(dataSize); //Allocates a single, empty CacheChange. Allocated on Copy
             if(*chan == nullptr) return false;
             break;
+
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            if(m_freeCaches.empty())
+            {
+                if (!allocateGroup((uint16_t)(ceil((float)m_pool_size / 10) + 10)))
+                {
+                    return false;
+                }
+            }
+
+            if(!reservePayload(m_freeCaches.back(), dataSize))
+            {
+                return false;
+            }
+            *chan = m_freeCaches.back();
+            m_freeCaches.pop_back();
+            break;
     }
 
     return true;
@@ -148,6 +223,9 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
 
 void CacheChangePool::release_Cache(CacheChange_t* ch)
 {
+    // Get back the own payload buffer of the change, if it was referencing a shared one
+    ch->release_shared_payload();
+
     switch(memoryMode)
     {
         case PREALLOCATED_MEMORY_MODE:
@@ -179,6 +257,7 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
             m_freeCaches.push_back(ch);
             break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
+        {
             // Find pointer in CacheChange vector, remove element, then delete it
             std::vector<CacheChange_t*>::iterator target = m_allCaches.begin();
             target = find(m_allCaches.begin(),m_allCaches.end(), ch);
@@ -192,7 +271,22 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
             delete(ch);
             --m_pool_size;
             break;
-
+        }
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            releasePayload(ch);
+            ch->kind = ALIVE;
+            ch->sequenceNumber.high = 0;
+            ch->sequenceNumber.low = 0;
+            ch->writerGUID = c_Guid_Unknown;
+            ch->serializedPayload.length = 0;
+            ch->serializedPayload.pos = 0;
+            for(uint8_t i=0;i<16;++i)
+                ch->instanceHandle.value[i] = 0;
+            ch->isRead = 0;
+            ch->sourceTimestamp.seconds(0);
+            ch->sourceTimestamp.fraction(0);
+            m_freeCaches.push_back(ch);
+            break;
     }
 }
 
@@ -217,13 +311,38 @@ bool CacheChangePool::allocateGroup(uint32_t group_size)
             reserved = group_size;
         }
     }
-    for(uint32_t i = 0; i < reserved; ++i)
+    if(memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE && reserved > 0)
     {
-        CacheChange_t* ch = new CacheChange_t(m_payload_size);
-        m_allCaches.push_back(ch);
-        m_freeCaches.push_back(ch);
-        ++m_pool_size;
-        added = true;
+        // All the changes of the group share a block, each one on its own cache line.
+        void* block = malloc(reserved * change_stride + change_alignment - 1);
+        if(block == nullptr)
+        {
+            logError(RTPS_HISTORY, "Failed to allocate memory for a group of " << reserved << " cache changes");
+            return false;
+        }
+        m_changeBlocks.push_back(block);
+
+        uintptr_t first = (reinterpret_cast<uintptr_t>(block) + change_alignment - 1) &
+            ~static_cast<uintptr_t>(change_alignment - 1);
+        for(uint32_t i = 0; i < reserved; ++i)
+        {
+            CacheChange_t* ch = new (reinterpret_cast<void*>(first + i * change_stride)) CacheChange_t(0);
+            m_allCaches.push_back(ch);
+            m_freeCaches.push_back(ch);
+            ++m_pool_size;
+            added = true;
+        }
+    }
+    else
+    {
+        for(uint32_t i = 0; i < reserved; ++i)
+        {
+            CacheChange_t* ch = new CacheChange_t(m_payload_size);
+            m_allCaches.push_back(ch);
+            m_freeCaches.push_back(ch);
+            ++m_pool_size;
+            added = true;
+        }
     }
     if (!added)
         logWarning(RTPS_HISTORY, "Maximum number of allowed reserved caches reached");
@@ -266,6 +385,66 @@ CacheChange_t* CacheChangePool::allocateSingle(uint32_t dataSize)
     return ch;
 }
 
+bool CacheChangePool::reservePayload(CacheChange_t* ch, uint32_t dataSize)
+{
+    // This method should only be called from within DYNAMIC_REUSABLE_MEMORY_MODE
+    assert(memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE);
+
+    if(dataSize == 0)
+    {
+        return true;
+    }
+
+    uint32_t size_class = payload_class_for(dataSize);
+    std::vector<FreePayload>& free_payloads = m_freePayloads[size_class];
+    if(ch->serializedPayload.data == nullptr && !free_payloads.empty())
+    {
+        ch->serializedPayload.data = free_payloads.back().data;
+        ch->serializedPayload.max_size = free_payloads.back().max_size;
+        free_payloads.pop_back();
+    }
+
+    // Buffers on the last class may be smaller than requested, and need to be enlarged.
+    uint32_t buffer_size = size_class < 32 ? (1U << size_class) : dataSize;
+    try
+    {
+        ch->serializedPayload.reserve(buffer_size);
+    }
+    catch(std::bad_alloc& ex)
+    {
+        logError(RTPS_HISTORY, "Failed to allocate memory for the serializedPayload, exception caught: " << ex.what());
+        ch->serializedPayload.data = nullptr;
+        ch->serializedPayload.max_size = 0;
+        return false;
+    }
+
+    return true;
+}
+
+void CacheChangePool::releasePayload(CacheChange_t* ch)
+{
+    // This method should only be called from within DYNAMIC_REUSABLE_MEMORY_MODE
+    assert(memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE);
+
+    // The buffer may not be the one given on reservation (i.e. it was swapped when encrypting), so it is classified
+    // by its actual size.
+    if(ch->serializedPayload.data != nullptr)
+    {
+        if(ch->serializedPayload.max_size > 0)
+        {
+            FreePayload payload = {ch->serializedPayload.data, ch->serializedPayload.max_size};
+            m_freePayloads[payload_class_of(payload.max_size)].push_back(payload);
+        }
+        else
+        {
+            free(ch->serializedPayload.data);
+        }
+    }
+
+    ch->serializedPayload.data = nullptr;
+    ch->serializedPayload.max_size = 0;
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
@@ -33,6 +33,9 @@
 #include "../participant/RTPSParticipantImpl.h"
 
 #include <mutex>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 #include <limits>
 #include <cassert>
@@ -53,8 +56,12 @@ MessageReceiver::MessageReceiver(RTPSParticipantImpl* participant, uint32_t rec_
 #if HAVE_SECURITY
     m_crypto_msg(rec_buffer_size),
 #endif
+    associated_endpoints_(std::make_shared<AssociatedEndpoints>()),
+    dispatch_epoch_(0), dispatch_waiting_(false),
     sourceVendorId(c_VendorId_Unknown), participant_(participant)
 {
+    active_dispatches_[0] = 0;
+    active_dispatches_[1] = 0;
     init(rec_buffer_size);
 }
 
@@ -74,60 +81,301 @@ void MessageReceiver::init(uint32_t rec_buffer_size){
 MessageReceiver::~MessageReceiver()
 {
     logInfo(RTPS_MSG_IN,"");
-    assert(AssociatedWriters.size() == 0);
-    assert(AssociatedReaders.size() == 0);
+    assert(associated_endpoints_->writers.size() == 0);
+    assert(associated_endpoints_->readers.size() == 0);
 }
 
-void MessageReceiver::associateEndpoint(Endpoint *to_add){
-    bool found = false;
-    std::lock_guard<std::mutex> guard(mtx);
-    if(to_add->getAttributes().endpointKind == WRITER)
-    {
-        for(auto it = AssociatedWriters.begin(); it != AssociatedWriters.end(); ++it)
+class MessageReceiver::DispatchGuard
+{
+    public:
+
+        explicit DispatchGuard(MessageReceiver& receiver)
+            : receiver_(receiver)
         {
-            if( (*it) == (RTPSWriter*)to_add )
+            // Retried if waitForDispatches increases the epoch meanwhile, as it may have already checked the
+            // counter of the previous parity.
+            for(;;)
             {
-                found = true;
-                break;
+                uint32_t epoch = receiver_.dispatch_epoch_.load();
+                parity_ = epoch & 1u;
+                receiver_.active_dispatches_[parity_].fetch_add(1);
+                if(receiver_.dispatch_epoch_.load() == epoch)
+                    break;
+                release();
+            }
+        }
+
+        ~DispatchGuard()
+        {
+            release();
+        }
+
+    private:
+
+        void release()
+        {
+            if(receiver_.active_dispatches_[parity_].fetch_sub(1) == 1 && receiver_.dispatch_waiting_.load())
+            {
+                std::lock_guard<std::mutex> guard(receiver_.dispatch_mutex_);
+                receiver_.dispatch_cond_.notify_all();
             }
         }
-        if(!found) AssociatedWriters.push_back((RTPSWriter*)to_add);
+
+        MessageReceiver& receiver_;
+
+        uint32_t parity_;
+};
+
+void MessageReceiver::waitForDispatches()
+{
+    // Concurrent waits would reuse the parity of messages an earlier wait has not finished waiting for.
+    std::lock_guard<std::mutex> wait_guard(dispatch_wait_mutex_);
+
+    // Messages registering from now on load the current table.
+    uint32_t parity = dispatch_epoch_.fetch_add(1) & 1u;
+
+    std::unique_lock<std::mutex> lock(dispatch_mutex_);
+    dispatch_waiting_ = true;
+    dispatch_cond_.wait(lock, [this, parity]()
+    {
+        return active_dispatches_[parity].load() == 0;
+    });
+    dispatch_waiting_ = false;
+}
+
+template<typename Functor>
+std::shared_ptr<const MessageReceiver::AssociatedEndpoints> MessageReceiver::updateEndpoints(const Functor& modifier)
+{
+    std::shared_ptr<AssociatedEndpoints> endpoints = std::make_shared<AssociatedEndpoints>(
+            *std::atomic_load(&associated_endpoints_));
+    if(!modifier(*endpoints))
+    {
+        return nullptr;
     }
-    else
+
+    return std::atomic_exchange(&associated_endpoints_,
+            std::shared_ptr<const AssociatedEndpoints>(std::move(endpoints)));
+}
+
+static bool erase_reader(std::vector<RTPSReader*>& readers, RTPSReader* reader)
+{
+    auto it = std::find(readers.begin(), readers.end(), reader);
+    if(it == readers.end())
     {
-        for(auto it = AssociatedReaders.begin(); it != AssociatedReaders.end(); ++it)
+        return false;
+    }
+    readers.erase(it);
+    return true;
+}
+
+void MessageReceiver::associateEndpoint(Endpoint *to_add){
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    updateEndpoints([to_add](AssociatedEndpoints& endpoints) -> bool
+    {
+        if(to_add->getAttributes().endpointKind == WRITER)
         {
-            if( (*it) == (RTPSReader*)to_add )
+            RTPSWriter* writer = (RTPSWriter*)to_add;
+            if(std::find(endpoints.writers.begin(), endpoints.writers.end(), writer) != endpoints.writers.end())
+                return false;
+            endpoints.writers.push_back(writer);
+            endpoints.writers_by_id[writer->getGuid().entityId] = writer;
+        }
+        else
+        {
+            RTPSReader* reader = (RTPSReader*)to_add;
+            if(std::find(endpoints.readers.begin(), endpoints.readers.end(), reader) != endpoints.readers.end())
+                return false;
+            endpoints.readers.push_back(reader);
+            endpoints.readers_by_id[reader->getGuid().entityId] = reader;
+
+            // Readers filtering by matched writers are indexed when they match them.
+            if(reader->acceptMsgFromUnknownWriters())
+                endpoints.readers_from_any_writer.push_back(reader);
+            else if(reader->m_trustedWriterEntityId != c_EntityId_Unknown)
+                endpoints.readers_by_trusted_writer[reader->m_trustedWriterEntityId].push_back(reader);
+        }
+        return true;
+    });
+}
+
+void MessageReceiver::removeEndpoint(Endpoint *to_remove){
+
+    std::unique_lock<std::mutex> lock(endpoints_mutex_);
+    std::shared_ptr<const AssociatedEndpoints> old_endpoints = updateEndpoints(
+            [to_remove](AssociatedEndpoints& endpoints) -> bool
+    {
+        if(to_remove->getAttributes().endpointKind == WRITER){
+            RTPSWriter* writer = (RTPSWriter *)to_remove;
+            auto it = std::find(endpoints.writers.begin(), endpoints.writers.end(), writer);
+            if(it == endpoints.writers.end())
+                return false;
+            endpoints.writers.erase(it);
+            endpoints.writers_by_id.erase(writer->getGuid().entityId);
+        }else{
+            RTPSReader* reader = (RTPSReader *)to_remove;
+            if(!erase_reader(endpoints.readers, reader))
+                return false;
+            endpoints.readers_by_id.erase(reader->getGuid().entityId);
+            erase_reader(endpoints.readers_from_any_writer, reader);
+
+            auto trusted_it = endpoints.readers_by_trusted_writer.find(reader->m_trustedWriterEntityId);
+            if(trusted_it != endpoints.readers_by_trusted_writer.end() &&
+                    erase_reader(trusted_it->second, reader) && trusted_it->second.empty())
+                endpoints.readers_by_trusted_writer.erase(trusted_it);
+
+            for(auto writer_it = endpoints.readers_by_writer.begin(); writer_it != endpoints.readers_by_writer.end();)
             {
-                found = true;
-                break;
+                const ReaderVector& readers = *writer_it->second;
+                if(std::find(readers.begin(), readers.end(), reader) != readers.end())
+                {
+                    std::shared_ptr<ReaderVector> new_readers = std::make_shared<ReaderVector>(readers);
+                    erase_reader(*new_readers, reader);
+                    if(new_readers->empty())
+                    {
+                        writer_it = endpoints.readers_by_writer.erase(writer_it);
+                        continue;
+                    }
+                    writer_it->second = new_readers;
+                }
+                ++writer_it;
             }
         }
-        if(!found) AssociatedReaders.push_back((RTPSReader*)to_add);
+        return true;
+    });
+    lock.unlock();
+
+    // Messages being processed may still be using this or any older table. Wait for them, so the caller can
+    // safely destroy the endpoint once this method returns. No lock is held, as they may need to update the table.
+    if(old_endpoints)
+    {
+        waitForDispatches();
     }
-    return;
 }
-void MessageReceiver::removeEndpoint(Endpoint *to_remove){
 
-    std::lock_guard<std::mutex> guard(mtx);
-    if(to_remove->getAttributes().endpointKind == WRITER){
-        RTPSWriter* var = (RTPSWriter *)to_remove;
-        for(auto it=AssociatedWriters.begin(); it !=AssociatedWriters.end(); ++it){
-            if ((*it) == var){
-                AssociatedWriters.erase(it);
-                break;
+void MessageReceiver::matchedWriterAdded(RTPSReader* reader, const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
+    auto reader_it = endpoints->readers_by_id.find(reader->getGuid().entityId);
+    if(reader_it == endpoints->readers_by_id.end() || reader_it->second != reader)
+        return;
+
+    // Readers stop accepting unknown writers when they match the first one.
+    bool any_writer = reader->acceptMsgFromUnknownWriters();
+
+    auto writer_it = endpoints->readers_by_writer.find(writer_guid);
+    bool matched = writer_it != endpoints->readers_by_writer.end() &&
+        std::find(writer_it->second->begin(), writer_it->second->end(), reader) != writer_it->second->end();
+
+    updateEndpoints([reader, &writer_guid, any_writer, matched](AssociatedEndpoints& new_endpoints) -> bool
+    {
+        bool changed = !any_writer && erase_reader(new_endpoints.readers_from_any_writer, reader);
+        if(matched)
+            return changed;
+
+        // Only the list of the matched writer is copied. The rest are shared with the previous table.
+        std::shared_ptr<const ReaderVector>& readers = new_endpoints.readers_by_writer[writer_guid];
+        std::shared_ptr<ReaderVector> new_readers = readers ?
+            std::make_shared<ReaderVector>(*readers) : std::make_shared<ReaderVector>();
+        new_readers->push_back(reader);
+        readers = new_readers;
+        return true;
+    });
+}
+
+void MessageReceiver::matchedWriterRemoved(RTPSReader* reader, const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    updateEndpoints([reader, &writer_guid](AssociatedEndpoints& endpoints) -> bool
+    {
+        auto writer_it = endpoints.readers_by_writer.find(writer_guid);
+        if(writer_it == endpoints.readers_by_writer.end())
+            return false;
+
+        std::shared_ptr<ReaderVector> new_readers = std::make_shared<ReaderVector>(*writer_it->second);
+        if(!erase_reader(*new_readers, reader))
+            return false;
+        if(new_readers->empty())
+            endpoints.readers_by_writer.erase(writer_it);
+        else
+            writer_it->second = new_readers;
+        return true;
+    });
+}
+
+void MessageReceiver::readerFilterChanged(RTPSReader* reader)
+{
+    std::lock_guard<std::mutex> guard(endpoints_mutex_);
+    if(!reader->acceptMsgFromUnknownWriters())
+        removeReaderFromAnyWriter(reader);
+}
+
+void MessageReceiver::removeReaderFromAnyWriter(RTPSReader* reader)
+{
+    const ReaderVector& readers = std::atomic_load(&associated_endpoints_)->readers_from_any_writer;
+    if(std::find(readers.begin(), readers.end(), reader) == readers.end())
+        return;
+
+    updateEndpoints([reader](AssociatedEndpoints& endpoints) -> bool
+    {
+        return erase_reader(endpoints.readers_from_any_writer, reader);
+    });
+}
+
+template<typename Functor>
+void MessageReceiver::findAllReaders(const AssociatedEndpoints& endpoints, const EntityId_t& readerID,
+        const GUID_t& writerGUID, const Functor& callback) const
+{
+    if(readerID != c_EntityId_Unknown)
+    {
+        auto reader_it = endpoints.readers_by_id.find(readerID);
+        if(reader_it != endpoints.readers_by_id.end())
+        {
+            callback(reader_it->second);
+        }
+        return;
+    }
+
+    auto writer_it = endpoints.readers_by_writer.find(writerGUID);
+    const ReaderVector* matched_readers = writer_it != endpoints.readers_by_writer.end() ?
+        writer_it->second.get() : nullptr;
+    if(matched_readers)
+    {
+        for(RTPSReader* reader : *matched_readers)
+        {
+            if(reader->m_acceptMessagesToUnknownReaders)
+            {
+                callback(reader);
             }
         }
-    }else{
-        RTPSReader *var = (RTPSReader *)to_remove;
-        for(auto it=AssociatedReaders.begin(); it !=AssociatedReaders.end(); ++it){
-            if ((*it) == var){
-                AssociatedReaders.erase(it);
-                break;
+    }
+
+    // A reader may also have matched the writer, avoid delivering twice.
+    auto not_matched = [matched_readers](RTPSReader* reader) -> bool
+    {
+        return !matched_readers ||
+            std::find(matched_readers->begin(), matched_readers->end(), reader) == matched_readers->end();
+    };
+
+    auto trusted_it = endpoints.readers_by_trusted_writer.find(writerGUID.entityId);
+    if(trusted_it != endpoints.readers_by_trusted_writer.end())
+    {
+        for(RTPSReader* reader : trusted_it->second)
+        {
+            if(reader->m_acceptMessagesToUnknownReaders && not_matched(reader))
+            {
+                callback(reader);
             }
         }
     }
-    return;
+
+    for(RTPSReader* reader : endpoints.readers_from_any_writer)
+    {
+        if(reader->m_acceptMessagesToUnknownReaders && not_matched(reader))
+        {
+            callback(reader);
+        }
+    }
 }
 
 
@@ -153,6 +401,9 @@ void MessageReceiver::processCDRMsg(const Locator_t& loc, CDRMessage_t*msg)
 
     this->reset();
 
+    // Endpoints found while dispatching the message are not destroyed until it finishes.
+    DispatchGuard dispatch_guard(*this);
+
     GuidPrefix_t participantGuidPrefix = participant_->getGuid().guidPrefix;
     destGuidPrefix = participantGuidPrefix;
 
@@ -413,7 +664,7 @@ bool MessageReceiver::readSubmessageHeader(CDRMessage_t* msg, SubmessageHeader_t
 
 bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh)
 {
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
 
     //READ and PROCESS
     if(smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -451,23 +702,13 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
 
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
 
-    RTPSReader* firstReader = nullptr;
-    if(AssociatedReaders.empty())
+    if(endpoints->readers.empty())
     {
         logWarning(RTPS_MSG_IN,IDSTRING"Data received when NO readers are listening");
         return false;
     }
 
-    for(std::vector<RTPSReader*>::iterator it=AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
-    {
-        if((*it)->acceptMsgDirectedTo(readerID)) //add
-        {
-            firstReader = *it;
-            break;
-        }
-    }
-    if(firstReader == nullptr) //Reader not found
+    if(readerID != c_EntityId_Unknown && endpoints->readers_by_id.count(readerID) == 0) //Reader not found
     {
         logWarning(RTPS_MSG_IN, IDSTRING"No Reader accepts this message (directed to: " <<readerID << ")");
         return false;
@@ -565,18 +806,26 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
 
 
     //FIXME: DO SOMETHING WITH PARAMETERLIST CREATED.
-    logInfo(RTPS_MSG_IN,IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: "<<AssociatedReaders.size());
+    logInfo(RTPS_MSG_IN,IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: "<<endpoints->readers.size());
     //Look for the correct reader to add the change
-    for(std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    // When several readers are going to store the sample, the payload is copied once and shared by all of them
+    data_readers_.clear();
+    findAllReaders(*endpoints, readerID, ch.writerGUID, [this](RTPSReader* reader)
     {
-        if((*it)->acceptMsgDirectedTo(readerID))
-        {
-            (*it)->processDataMsg(&ch);
-        }
+        data_readers_.push_back(reader);
+    });
+    if(data_readers_.size() > 1)
+    {
+        ch.make_shared_payload();
+    }
+
+    for(RTPSReader* reader : data_readers_)
+    {
+        reader->processDataMsg(&ch);
     }
 
     //TODO(Ricardo) If a exception is thrown (ex, by fastcdr), this line is not executed -> segmentation fault
+    ch.release_shared_payload();
     ch.serializedPayload.data = nullptr;
 
     logInfo(RTPS_MSG_IN,IDSTRING"Sub Message DATA processed");
@@ -585,7 +834,7 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
 
 bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t* smh)
 {
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
 
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
@@ -617,24 +866,13 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
     valid &= CDRMessage::readEntityId(msg, &readerID);
 
     //WE KNOW THE READER THAT THE MESSAGE IS DIRECTED TO SO WE LOOK FOR IT:
-    if(AssociatedReaders.empty())
+    if(endpoints->readers.empty())
     {
         logWarning(RTPS_MSG_IN, IDSTRING"Data received when NO readers are listening");
         return false;
     }
 
-    RTPSReader* firstReader = nullptr;
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
-    {
-        if ((*it)->acceptMsgDirectedTo(readerID)) //add
-        {
-            firstReader = *it;
-            break;
-        }
-    }
-
-    if (firstReader == nullptr) //Reader not found
+    if (readerID != c_EntityId_Unknown && endpoints->readers_by_id.count(readerID) == 0) //Reader not found
     {
         logWarning(RTPS_MSG_IN, IDSTRING"No Reader accepts this message (directed to: " << readerID << ")");
         return false;
@@ -755,16 +993,12 @@ bool MessageReceiver::proc_Submsg_DataFrag(CDRMessage_t* msg, SubmessageHeader_t
         ch.sourceTimestamp = this->timestamp;
 
     //FIXME: DO SOMETHING WITH PARAMETERLIST CREATED.
-    logInfo(RTPS_MSG_IN, IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: " << AssociatedReaders.size());
+    logInfo(RTPS_MSG_IN, IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: " << endpoints->readers.size());
     //Look for the correct reader to add the change
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    findAllReaders(*endpoints, readerID, ch.writerGUID, [&](RTPSReader* reader)
     {
-        if ((*it)->acceptMsgDirectedTo(readerID))
-        {
-            (*it)->processDataFragMsg(&ch, sampleSize, fragmentStartingNum);
-        }
-    }
+        reader->processDataFragMsg(&ch, sampleSize, fragmentStartingNum);
+    });
 
     ch.serializedPayload.data = nullptr;
 
@@ -802,16 +1036,12 @@ bool MessageReceiver::proc_Submsg_Heartbeat(CDRMessage_t* msg,SubmessageHeader_t
     uint32_t HBCount;
     CDRMessage::readUInt32(msg,&HBCount);
 
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
     //Look for the correct reader and writers:
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    findAllReaders(*endpoints, readerGUID.entityId, writerGUID, [&](RTPSReader* reader)
     {
-        if((*it)->acceptMsgDirectedTo(readerGUID.entityId))
-        {
-            (*it)->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
-        }
-    }
+        reader->processHeartbeatMsg(writerGUID, HBCount, firstSN, lastSN, finalFlag, livelinessFlag);
+    });
     return true;
 }
 
@@ -836,13 +1066,13 @@ bool MessageReceiver::proc_Submsg_Acknack(CDRMessage_t* msg,SubmessageHeader_t*
     uint32_t Ackcount;
     CDRMessage::readUInt32(msg,&Ackcount);
 
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
     //Look for the correct writer to use the acknack
-    for (std::vector<RTPSWriter*>::iterator it = AssociatedWriters.begin();
-            it != AssociatedWriters.end(); ++it)
+    auto writer_it = endpoints->writers_by_id.find(writerGUID.entityId);
+    if (writer_it != endpoints->writers_by_id.end())
     {
         bool result;
-        if ((*it)->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result))
+        if (writer_it->second->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result))
         {
             if (!result)
             {
@@ -852,7 +1082,7 @@ bool MessageReceiver::proc_Submsg_Acknack(CDRMessage_t* msg,SubmessageHeader_t*
         }
     }
     logInfo(RTPS_MSG_IN,IDSTRING"Acknack msg to UNKNOWN writer (I loooked through "
-            << AssociatedWriters.size() << " writers in this ListenResource)");
+            << endpoints->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -878,15 +1108,11 @@ bool MessageReceiver::proc_Submsg_Gap(CDRMessage_t* msg,SubmessageHeader_t* smh)
     if(gapStart <= SequenceNumber_t(0, 0))
         return false;
 
-    std::lock_guard<std::mutex> guard(mtx);
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
+    findAllReaders(*endpoints, readerGUID.entityId, writerGUID, [&](RTPSReader* reader)
     {
-        if((*it)->acceptMsgDirectedTo(readerGUID.entityId))
-        {
-            (*it)->processGapMsg(writerGUID, gapStart, gapList);
-        }
-    }
+        reader->processGapMsg(writerGUID, gapStart, gapList);
+    });
 
     return true;
 }
@@ -978,13 +1204,13 @@ bool MessageReceiver::proc_Submsg_NackFrag(CDRMessage_t*msg, SubmessageHeader_t*
     uint32_t Ackcount;
     CDRMessage::readUInt32(msg, &Ackcount);
 
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
     //Look for the correct writer to use the acknack
-    for (std::vector<RTPSWriter*>::iterator it = AssociatedWriters.begin();
-            it != AssociatedWriters.end(); ++it)
+    auto writer_it = endpoints->writers_by_id.find(writerGUID.entityId);
+    if (writer_it != endpoints->writers_by_id.end())
     {
         bool result;
-        if ((*it)->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result))
+        if (writer_it->second->process_nack_frag(writerGUID, readerGUID, Ackcount, writerSN, fnState, result))
         {
             if (!result)
             {
@@ -994,7 +1220,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(CDRMessage_t*msg, SubmessageHeader_t*
         }
     }
     logInfo(RTPS_MSG_IN, IDSTRING"Acknack msg to UNKNOWN writer (I looked through "
-            << AssociatedWriters.size() << " writers in this ListenResource)");
+            << endpoints->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1024,10 +1250,10 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(CDRMessage_t*msg, SubmessageHead
 
     // XXX TODO VALIDATE DATA?
 
-    std::lock_guard<std::mutex> guard(mtx);
+    std::shared_ptr<const AssociatedEndpoints> endpoints = std::atomic_load(&associated_endpoints_);
     //Look for the correct reader and writers:
-    for (std::vector<RTPSReader*>::iterator it = AssociatedReaders.begin();
-            it != AssociatedReaders.end(); ++it)
+    for (std::vector<RTPSReader*>::const_iterator it = endpoints->readers.begin();
+            it != endpoints->readers.end(); ++it)
     {
         /* XXX TODO PROCESS
            if ((*it)->acceptMsgDirectedTo(readerGUID.entityId))
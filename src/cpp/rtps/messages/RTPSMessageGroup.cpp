@@ -148,6 +148,9 @@ RTPSMessageGroup::RTPSMessageGroup(
     , endpoint_(endpoint)
     , full_msg_(&msg_group.rtpsmsg_fullmsg_)
     , submessage_msg_(&msg_group.rtpsmsg_submessage_)
+    , payloads_(&msg_group.rtpsmsg_payloads_)
+    , buffers_(&msg_group.rtpsmsg_buffers_)
+    , referenced_bytes_(0)
     , currentBytesSent_(0)
     , fixed_destination_(false)
     , fixed_destination_locators_(nullptr)
@@ -236,6 +239,8 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+    payloads_->clear();
+    referenced_bytes_ = 0;
 }
 
 bool RTPSMessageGroup::check_preconditions(const LocatorList_t& locator_list,
@@ -286,15 +291,28 @@ void RTPSMessageGroup::send()
 #endif
         const LocatorList_t & destinations =
             fixed_destination_ ? *fixed_destination_locators_ : current_locators_;
-        for(const auto& lit : destinations)
+
+        // Interleave the referenced payloads with the pieces of the message that surround them.
+        buffers_->clear();
+        uint32_t offset = 0;
+        for(const auto& payload : *payloads_)
         {
-            if(!participant_->sendSync(msgToSend, endpoint_, lit, max_blocking_time_point_))
-            {
-                throw timeout();
-            }
+            buffers_->emplace_back(msgToSend->buffer + offset, payload.first - offset);
+            buffers_->push_back(payload.second);
+            offset = payload.first;
+        }
+        if(offset < msgToSend->length)
+        {
+            buffers_->emplace_back(msgToSend->buffer + offset, msgToSend->length - offset);
         }
 
-        currentBytesSent_ += msgToSend->length;
+        uint32_t total_bytes = msgToSend->length + referenced_bytes_;
+        if(!participant_->sendSync(*buffers_, total_bytes, endpoint_, destinations, max_blocking_time_point_))
+        {
+            throw timeout();
+        }
+
+        currentBytesSent_ += total_bytes;
     }
 }
 
@@ -332,9 +350,53 @@ void RTPSMessageGroup::check_and_maybe_flush(const LocatorList_t& locator_list,
     add_info_dst_in_buffer(submessage_msg_, remote_endpoints);
 }
 
-bool RTPSMessageGroup::insert_submessage(const std::vector<GUID_t>& remote_endpoints)
+bool RTPSMessageGroup::can_reference_payload() const
 {
+#if HAVE_SECURITY
+    // Protected contents are transformed by the security plugins, so the payload has to be copied.
+    if((participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection()) ||
+        endpoint_->getAttributes().security_attributes().is_submessage_protected ||
+        endpoint_->getAttributes().security_attributes().is_payload_protected)
+    {
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+bool RTPSMessageGroup::append_submessage(const NetworkBuffer& payload, uint32_t payload_position)
+{
+    // Referenced payloads are not stored on full_msg_, but they count for the size of the message.
+    if(full_msg_->length + referenced_bytes_ + submessage_msg_->length + payload.size > full_msg_->max_size)
+    {
+        return false;
+    }
+
+    uint32_t submessage_position = full_msg_->pos;
     if(!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    {
+        return false;
+    }
+
+    if(payload.size > 0)
+    {
+        payloads_->emplace_back(submessage_position + payload_position, payload);
+        referenced_bytes_ += payload.size;
+    }
+
+    return true;
+}
+
+bool RTPSMessageGroup::insert_submessage(const std::vector<GUID_t>& remote_endpoints)
+{
+    return insert_submessage(remote_endpoints, NetworkBuffer(), 0);
+}
+
+bool RTPSMessageGroup::insert_submessage(const std::vector<GUID_t>& remote_endpoints,
+        const NetworkBuffer& payload, uint32_t payload_position)
+{
+    if(!append_submessage(payload, payload_position))
     {
         // Retry
         flush();
@@ -347,7 +409,7 @@ bool RTPSMessageGroup::insert_submessage(const std::vector<GUID_t>& remote_endpo
             return false;
         }
 
-        if(!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+        if(!append_submessage(payload, payload_position))
         {
             logError(RTPS_WRITER,"Cannot add RTPS submesage to the CDRMessage. Buffer too small");
             return false;
@@ -459,10 +521,11 @@ bool RTPSMessageGroup::add_data(
 #endif
     const EntityId_t& readerId = get_entity_id(remote_readers);
 
-    // TODO (Ricardo). Check to create special wrapper.
+    // Unless it has to be protected, the payload is referenced instead of copied into the message.
+    uint32_t payload_position = 0;
 
     if(!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change, endpoint_->getAttributes().topicKind,
-                readerId, expectsInlineQos, inlineQos))
+                readerId, expectsInlineQos, inlineQos, can_reference_payload() ? &payload_position : nullptr))
     {
         logError(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         return false;
@@ -494,7 +557,13 @@ bool RTPSMessageGroup::add_data(
     }
 #endif
 
-    return insert_submessage(remote_readers);
+    NetworkBuffer payload;
+    if(payload_position != 0)
+    {
+        payload = NetworkBuffer(change.serializedPayload.data, change.serializedPayload.length);
+    }
+
+    return insert_submessage(remote_readers, payload, payload_position);
 }
 
 bool RTPSMessageGroup::add_data_frag(
@@ -558,14 +627,23 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif
 
+    // Unless it has to be protected, the fragment is referenced instead of copied into the message.
+    uint32_t payload_position = 0;
+
     if(!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change_to_add, fragment_number,
                 change.serializedPayload.length, endpoint_->getAttributes().topicKind, readerId,
-                expectsInlineQos, inlineQos))
+                expectsInlineQos, inlineQos, can_reference_payload() ? &payload_position : nullptr))
     {
         logError(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = NULL;
         return false;
     }
+
+    NetworkBuffer payload;
+    if(payload_position != 0)
+    {
+        payload = NetworkBuffer(change_to_add.serializedPayload.data, change_to_add.serializedPayload.length);
+    }
     change_to_add.serializedPayload.data = NULL;
 
 #if HAVE_SECURITY
@@ -594,7 +672,7 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif
 
-    return insert_submessage(remote_readers);
+    return insert_submessage(remote_readers, payload, payload_position);
 }
 
 bool RTPSMessageGroup::add_heartbeat(const std::vector<GUID_t>& remote_readers, const SequenceNumber_t& firstSN,
@@ -805,6 +883,33 @@ bool RTPSMessageGroup::add_nackfrag(const std::vector<GUID_t>& remote_writers, S
     return insert_submessage(remote_writers);
 }
 
+void RTPSMessageGroup::set_endpoint(Endpoint* endpoint)
+{
+    assert(endpoint);
+
+#if HAVE_SECURITY
+    // Protected messages cannot be shared with endpoints not protecting them, and the other way round.
+    if (participant_->security_attributes().is_rtps_protected &&
+            endpoint_->supports_rtps_protection() != endpoint->supports_rtps_protection())
+    {
+        flush();
+        current_dst_ = c_GuidPrefix_Unknown;
+
+        if (fixed_destination_)
+        {
+            get_participants_from_endpoints(*fixed_destination_guids_, current_remote_participants_);
+        }
+        else
+        {
+            // Force the destinations to be taken again on the next submessage.
+            current_locators_.clear();
+        }
+    }
+#endif
+
+    endpoint_ = endpoint;
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
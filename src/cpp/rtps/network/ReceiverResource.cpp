@@ -101,6 +101,29 @@ void ReceiverResource::OnDataReceived(const octet * data, const uint32_t size,
 
 }
 
+void ReceiverResource::OnDataBatchReceived(const CDRMessage_t* messages, const Locator_t* remote_locators,
+    uint32_t count, const Locator_t& localLocator)
+{
+    (void)localLocator;
+
+    std::unique_lock<std::mutex> lock(mtx);
+    MessageReceiver* rcv = receiver;
+
+    if (rcv != nullptr)
+    {
+        msg.wraps = true;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            msg.buffer = messages[i].buffer;
+            msg.length = messages[i].length;
+            msg.max_size = messages[i].length;
+
+            rcv->processCDRMsg(remote_locators[i], &msg);
+        }
+    }
+}
+
 void ReceiverResource::disable()
 {
     if (Cleanup)
@@ -21,6 +21,8 @@
 
 #include "../flowcontrol/ThroughputController.h"
 #include "../persistence/PersistenceService.h"
+#include "../RTPSDomainImpl.h"
+#include "../writer/HeartbeatScheduler.h"
 
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
@@ -84,6 +86,8 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     : m_att(PParam)
     , m_guid(guidP ,c_EntityId_RTPSParticipant)
     , mp_event_thr(nullptr)
+    , async_writer_thread_(nullptr)
+    , heartbeat_scheduler_(nullptr)
     , mp_builtinProtocols(nullptr)
     , mp_ResourceSemaphore(new Semaphore(0))
     , IdCounter(0)
@@ -112,6 +116,12 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     mp_userParticipant->mp_impl = this;
     mp_event_thr = new ResourceEvent();
     mp_event_thr->init_thread(this);
+    async_writer_thread_ = new AsyncWriterThread(m_att.asyncWriterThreads);
+
+    if (m_att.heartbeatCoalescingPeriod != c_TimeZero)
+    {
+        heartbeat_scheduler_ = new HeartbeatScheduler(this, m_att.heartbeatCoalescingPeriod);
+    }
 
     // Throughput controller, if the descriptor has valid values
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
@@ -131,9 +141,13 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     /* INSERT DEFAULT MANDATORY MULTICAST LOCATORS HERE */
     if(m_att.builtin.metatrafficMulticastLocatorList.empty() && m_att.builtin.metatrafficUnicastLocatorList.empty())
     {
-        m_network_Factory.getDefaultMetatrafficMulticastLocators(m_att.builtin.metatrafficMulticastLocatorList,
-            metatraffic_multicast_port);
-        m_network_Factory.NormalizeLocators(m_att.builtin.metatrafficMulticastLocatorList);
+        // Clients and servers of the discovery server protocol don't use multicast.
+        if(m_att.builtin.discoveryProtocol == DiscoveryProtocol_t::SIMPLE)
+        {
+            m_network_Factory.getDefaultMetatrafficMulticastLocators(m_att.builtin.metatrafficMulticastLocatorList,
+                metatraffic_multicast_port);
+            m_network_Factory.NormalizeLocators(m_att.builtin.metatrafficMulticastLocatorList);
+        }
 
         m_network_Factory.getDefaultMetatrafficUnicastLocators(m_att.builtin.metatrafficUnicastLocatorList,
             metatraffic_unicast_port);
@@ -159,6 +173,16 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     createReceiverResources(m_att.builtin.metatrafficMulticastLocatorList, true);
     createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true);
 
+    // Clients announce themselves to their discovery servers.
+    if(m_att.builtin.discoveryProtocol == DiscoveryProtocol_t::CLIENT)
+    {
+        if(m_att.builtin.discoveryServerList.empty())
+        {
+            logError(RTPS_PARTICIPANT, "Discovery client without discovery servers will not discover anyone");
+        }
+        m_att.builtin.initialPeersList.push_back(m_att.builtin.discoveryServerList);
+    }
+
     // Initial peers
     if(m_att.builtin.initialPeersList.empty())
     {
@@ -269,6 +293,10 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     m_security_manager.destroy();
 #endif
 
+    // All writers are gone, so the asynchronous threads and the heartbeat scheduler can be stopped
+    delete(this->async_writer_thread_);
+    delete(this->heartbeat_scheduler_);
+
     // Destruct message receivers
     for (auto& block : m_receiverResourcelist)
     {
@@ -432,6 +460,7 @@ bool RTPSParticipantImpl::createWriter(
     if (!isBuiltin)
     {
         m_userWriterList.push_back(SWriter);
+        m_userWritersByGuid[SWriter->getGuid()] = SWriter;
     }
     *WriterOut = SWriter;
 
@@ -589,6 +618,8 @@ bool RTPSParticipantImpl::createReader(
     if (!isBuiltin)
     {
         m_userReaderList.push_back(SReader);
+        m_userReadersByGuid[SReader->getGuid()] = SReader;
+        RTPSDomainImpl::register_local_reader(SReader);
     }
     *ReaderOut = SReader;
     return true;
@@ -606,12 +637,51 @@ bool RTPSParticipantImpl::enableReader(RTPSReader *reader)
 // Avoid to receive PDPSimple reader a DATA while calling ~PDPSimple and EDP was destroy already.
 void RTPSParticipantImpl::disableReader(RTPSReader *reader)
 {
+    removeEndpointFromReceivers(reader);
+}
+
+void RTPSParticipantImpl::removeEndpointFromReceivers(Endpoint* endpoint)
+{
+    // Removal waits for the messages being processed, which may need the list mutex, so it is not held meanwhile.
+    std::vector<MessageReceiver*> receivers;
     m_receiverResourcelistMutex.lock();
     for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
     {
-        it->mp_receiver->removeEndpoint(reader);
+        receivers.push_back(it->mp_receiver);
     }
     m_receiverResourcelistMutex.unlock();
+
+    for (MessageReceiver* receiver : receivers)
+    {
+        receiver->removeEndpoint(endpoint);
+    }
+}
+
+void RTPSParticipantImpl::matchedWriterAdded(RTPSReader* reader, const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+    {
+        it->mp_receiver->matchedWriterAdded(reader, writer_guid);
+    }
+}
+
+void RTPSParticipantImpl::matchedWriterRemoved(RTPSReader* reader, const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+    {
+        it->mp_receiver->matchedWriterRemoved(reader, writer_guid);
+    }
+}
+
+void RTPSParticipantImpl::readerFilterChanged(RTPSReader* reader)
+{
+    std::lock_guard<std::mutex> guard(m_receiverResourcelistMutex);
+    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
+    {
+        it->mp_receiver->readerFilterChanged(reader);
+    }
 }
 
 bool RTPSParticipantImpl::registerWriter(RTPSWriter* Writer, const TopicAttributes& topicAtt, const WriterQos& wqos)
@@ -831,12 +901,7 @@ void RTPSParticipantImpl::createSenderResources(LocatorList_t& Locator_list, boo
 
 bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
 {
-    m_receiverResourcelistMutex.lock();
-    for (auto it = m_receiverResourcelist.begin(); it != m_receiverResourcelist.end(); ++it)
-    {
-        it->mp_receiver->removeEndpoint(p_endpoint);
-    }
-    m_receiverResourcelistMutex.unlock();
+    removeEndpointFromReceivers(p_endpoint);
 
     bool found = false, found_in_users = false;
     {
@@ -847,6 +912,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
             {
                 if ((*wit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
                 {
+                    m_userWritersByGuid.erase((*wit)->getGuid());
                     m_userWriterList.erase(wit);
                     found_in_users = true;
                     break;
@@ -869,6 +935,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
             {
                 if ((*rit)->getGuid().entityId == p_endpoint->getGuid().entityId) //Found it
                 {
+                    m_userReadersByGuid.erase((*rit)->getGuid());
                     m_userReaderList.erase(rit);
                     found_in_users = true;
                     break;
@@ -909,6 +976,7 @@ bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
         {
             if (found_in_users)
             {
+                RTPSDomainImpl::unregister_local_reader(static_cast<RTPSReader*>(p_endpoint));
                 mp_builtinProtocols->removeLocalReader(static_cast<RTPSReader*>(p_endpoint));
             }
 
@@ -926,6 +994,18 @@ bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
     return true;
 }
 
+RTPSWriter* RTPSParticipantImpl::find_user_writer(const GUID_t& writer_guid) const
+{
+    auto it = m_userWritersByGuid.find(writer_guid);
+    return it != m_userWritersByGuid.end() ? it->second : nullptr;
+}
+
+RTPSReader* RTPSParticipantImpl::find_user_reader(const GUID_t& reader_guid) const
+{
+    auto it = m_userReadersByGuid.find(reader_guid);
+    return it != m_userReadersByGuid.end() ? it->second : nullptr;
+}
+
 void RTPSParticipantImpl::normalize_endpoint_locators(EndpointAttributes& endpoint_att)
 {
     // Locators with port 0, calculate port.
@@ -962,9 +1042,10 @@ std::vector<std::string> RTPSParticipantImpl::getParticipantNames() const
 }
 
 bool RTPSParticipantImpl::sendSync(
-        CDRMessage_t* msg,
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
         Endpoint* /*pend*/,
-        const Locator_t& destination_loc,
+        const LocatorList_t& destination_locators,
         std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     bool ret_code = false;
@@ -976,7 +1057,7 @@ bool RTPSParticipantImpl::sendSync(
 
         for (auto& send_resource : send_resource_list_)
         {
-            send_resource->send(msg->buffer, msg->length, destination_loc);
+            send_resource->send(buffers, total_bytes, destination_locators);
         }
     }
 
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <list>
+#include <unordered_map>
 #include <sys/types.h>
 #include <mutex>
 #include <atomic>
@@ -64,6 +65,7 @@ class RTPSParticipant;
 class RTPSParticipantListener;
 class ResourceEvent;
 class AsyncWriterThread;
+class HeartbeatScheduler;
 class BuiltinProtocols;
 struct CDRMessage_t;
 class Endpoint;
@@ -181,13 +183,50 @@ public:
     //!Get Pointer to the Event Resource.
     ResourceEvent& getEventResource();
 
-    //!Send Method - Deprecated - Stays here for reference purposes
+    //!Get the pool of threads sending on behalf of the asynchronous writers of this participant.
+    AsyncWriterThread& async_writer_thread() const { return *async_writer_thread_; }
+
+    //!Get the scheduler of the periodic heartbeats of the writers, or nullptr when they are not coalesced.
+    HeartbeatScheduler* heartbeat_scheduler() const { return heartbeat_scheduler_; }
+
+    /**
+     * Send a gather list of buffers to a set of destinations through all the send resources.
+     * Each send resource is given the whole destination list at once, so it can batch the send.
+     * @param buffers List of buffers to be sent as a single datagram.
+     * @param total_bytes Sum of the sizes of all the buffers.
+     * @param pend Endpoint sending the message.
+     * @param destination_locators Locators where the message should be sent.
+     * @param max_blocking_time_point Time point until which the call may block.
+     * @return true when the send resources could be accessed before max_blocking_time_point.
+     */
     bool sendSync(
-            CDRMessage_t* msg,
+            const NetworkBufferList& buffers,
+            uint32_t total_bytes,
             Endpoint *pend,
-            const Locator_t& destination_loc,
+            const LocatorList_t& destination_locators,
             std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Notify the message receivers that a writer has been matched by a local reader, so messages from that writer
+     * addressed to ENTITYID_UNKNOWN are dispatched to the reader.
+     * @param reader Local reader.
+     * @param writer_guid GUID of the matched writer.
+     */
+    void matchedWriterAdded(RTPSReader* reader, const GUID_t& writer_guid);
+
+    /**
+     * Notify the message receivers that a writer is no longer matched by a local reader.
+     * @param reader Local reader.
+     * @param writer_guid GUID of the unmatched writer.
+     */
+    void matchedWriterRemoved(RTPSReader* reader, const GUID_t& writer_guid);
+
+    /**
+     * Notify the message receivers that a local reader no longer accepts messages from writers it has not matched.
+     * @param reader Local reader.
+     */
+    void readerFilterChanged(RTPSReader* reader);
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const { return mp_mutex; };
 
@@ -261,6 +300,10 @@ private:
     // ResourceSend* mp_send_thr;
     //! Event Resource
     ResourceEvent* mp_event_thr;
+    //! Pool of threads for asynchronous writers
+    AsyncWriterThread* async_writer_thread_;
+    //! Scheduler of the coalesced periodic heartbeats
+    HeartbeatScheduler* heartbeat_scheduler_;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Semaphore to wait for the listen thread creation.
@@ -276,6 +319,10 @@ private:
     std::vector<RTPSWriter*> m_userWriterList;
     //!Reader List
     std::vector<RTPSReader*> m_userReaderList;
+    //!User writers indexed by GUID.
+    std::unordered_map<GUID_t, RTPSWriter*, GUIDHash> m_userWritersByGuid;
+    //!User readers indexed by GUID.
+    std::unordered_map<GUID_t, RTPSReader*, GUIDHash> m_userReadersByGuid;
     //!Network Factory
     NetworkFactory m_network_Factory;
 
@@ -404,6 +451,9 @@ private:
 
         void disableReader(RTPSReader *reader);
 
+        //!Remove an endpoint from all the message receivers, waiting for the messages they are processing.
+        void removeEndpointFromReceivers(Endpoint* endpoint);
+
         /**
          * Register a Writer in the BuiltinProtocols.
          * @param Writer Pointer to the RTPSWriter.
@@ -477,6 +527,20 @@ private:
          */
         std::vector<RTPSWriter*>::iterator userWritersListEnd(){return m_userWriterList.end();};
 
+        /**
+         * Look for a user writer by its GUID. Should be called with the participant mutex locked.
+         * @param writer_guid GUID of the writer.
+         * @return Pointer to the writer, or nullptr if it is not a user writer of this participant.
+         */
+        RTPSWriter* find_user_writer(const GUID_t& writer_guid) const;
+
+        /**
+         * Look for a user reader by its GUID. Should be called with the participant mutex locked.
+         * @param reader_guid GUID of the reader.
+         * @return Pointer to the reader, or nullptr if it is not a user reader of this participant.
+         */
+        RTPSReader* find_user_reader(const GUID_t& reader_guid) const;
+
         /** Helper function that creates ReceiverResources based on a Locator_t List, possibly mutating
           some and updating the list. DOES NOT associate endpoints with it.
           @param Locator_list - Locator list to be used to create the ReceiverResources
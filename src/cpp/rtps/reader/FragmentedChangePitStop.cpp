@@ -16,31 +16,20 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/rtps/reader/RTPSReader.h>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps::rtps;
 
 CacheChange_t* FragmentedChangePitStop::process(CacheChange_t* incoming_change, uint32_t sampleSize, uint32_t fragmentStartingNum)
 {
     CacheChange_t* returnedValue = nullptr;
 
-    // Search CacheChange_t with the sample sequence number.
-    auto range = changes_.equal_range(ChangeInPit(incoming_change));
-
-    auto original_change_cit = range.first;
-
-    // If there is a range, search the CacheChange_t with the same writer GUID_t.
-    if(original_change_cit != changes_.end())
-    {
-        for(; original_change_cit != range.second; ++original_change_cit)
-        {
-            if(original_change_cit->getChange()->writerGUID == incoming_change->writerGUID)
-                break;
-        }
-    }
-    else
-        original_change_cit = range.second;
+    // Search CacheChange_t with the sample writer GUID_t and sequence number.
+    ChangeKey key{incoming_change->writerGUID, incoming_change->sequenceNumber};
+    auto original_change_cit = changes_.find(key);
 
     // If not found an existing CacheChange_t, reserve one and insert.
-    if(original_change_cit == range.second)
+    if(original_change_cit == changes_.end())
     {
         CacheChange_t* original_change = nullptr;
 
@@ -60,49 +49,43 @@ CacheChange_t* FragmentedChangePitStop::process(CacheChange_t* incoming_change,
         original_change->setFragmentSize(incoming_change->getFragmentSize());
 
         // Insert
-        original_change_cit = changes_.insert(ChangeInPit(original_change));
+        original_change_cit = changes_.emplace(key, ChangeInPit{original_change, original_change->getFragmentCount()}).first;
     }
 
-    bool was_updated = false;
-    for (uint32_t count = (fragmentStartingNum - 1); count < (fragmentStartingNum - 1) + incoming_change->getFragmentCount(); ++count)
+    ChangeInPit& change_in_pit = original_change_cit->second;
+    CacheChange_t* original_change = change_in_pit.change;
+    std::vector<uint32_t>& fragments = *original_change->getDataFragments();
+    uint32_t fragment_count = original_change->getFragmentCount();
+    uint32_t fragment_size = original_change->getFragmentSize();
+
+    // Fragments out of the sample are ignored.
+    uint32_t first_fragment = fragmentStartingNum - 1;
+    uint32_t end_fragment = fragmentStartingNum == 0 ? 0 :
+        std::min(first_fragment + incoming_change->getFragmentCount(), fragment_count);
+
+    for (uint32_t count = first_fragment; count < end_fragment; ++count)
     {
-        if(original_change_cit->getChange()->getDataFragments()->at(count) == ChangeFragmentStatus_t::NOT_PRESENT)
+        if(fragments[count] == ChangeFragmentStatus_t::NOT_PRESENT)
         {
-            // All cases minus last fragment.
-            if (count + 1 != original_change_cit->getChange()->getFragmentCount())
-            {
-                memcpy(original_change_cit->getChange()->serializedPayload.data + count * original_change_cit->getChange()->getFragmentSize(),
-                        incoming_change->serializedPayload.data + (count - (fragmentStartingNum - 1)) * incoming_change->getFragmentSize(), incoming_change->getFragmentSize());
-            }
+            uint32_t offset = count * fragment_size;
             // Last fragment is a special case when copying.
-            else
-            {
-                memcpy(original_change_cit->getChange()->serializedPayload.data + count * original_change_cit->getChange()->getFragmentSize(),
-                        incoming_change->serializedPayload.data + (count - (fragmentStartingNum - 1)) * incoming_change->getFragmentSize(), original_change_cit->getChange()->serializedPayload.length - (count * original_change_cit->getChange()->getFragmentSize()));
-            }
+            uint32_t length = (count + 1 != fragment_count) ?
+                fragment_size : original_change->serializedPayload.length - offset;
 
-            original_change_cit->getChange()->getDataFragments()->at(count) = ChangeFragmentStatus_t::PRESENT;
+            memcpy(original_change->serializedPayload.data + offset,
+                    incoming_change->serializedPayload.data + (count - first_fragment) * incoming_change->getFragmentSize(),
+                    length);
 
-            was_updated = true;
+            fragments[count] = ChangeFragmentStatus_t::PRESENT;
+            --change_in_pit.missing_fragments;
         }
     }
 
-    // If was updated, check if it is completed.
-    if(was_updated)
+    // If it is completed, return CacheChange_t and remove information.
+    if(change_in_pit.missing_fragments == 0)
     {
-        auto fit = original_change_cit->getChange()->getDataFragments()->begin();
-        for(; fit != original_change_cit->getChange()->getDataFragments()->end(); ++fit)
-        {
-            if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                break;
-        }
-
-        // If it is completed, return CacheChange_t and remove information.
-        if(fit == original_change_cit->getChange()->getDataFragments()->end())
-        {
-            returnedValue = original_change_cit->getChange();
-            changes_.erase(original_change_cit);
-        }
+        returnedValue = original_change;
+        changes_.erase(original_change_cit);
     }
 
     return returnedValue;
@@ -110,53 +93,24 @@ CacheChange_t* FragmentedChangePitStop::process(CacheChange_t* incoming_change,
 
 CacheChange_t* FragmentedChangePitStop::find(const SequenceNumber_t& sequence_number, const GUID_t& writer_guid)
 {
-    CacheChange_t* returnedValue = nullptr;
+    auto cit = changes_.find(ChangeKey{writer_guid, sequence_number});
 
-    auto range = changes_.equal_range(ChangeInPit(sequence_number));
-
-    auto cit = range.first;
-
-    // If there is a range, search the CacheChange_t with the same writer GUID_t.
-    if(cit != changes_.end())
-    {
-        for(; cit != range.second; ++cit)
-        {
-            if(cit->getChange()->writerGUID == writer_guid)
-            {
-                returnedValue = cit->getChange();
-                break;
-            }
-        }
-    }
-
-    return returnedValue;
+    return cit != changes_.end() ? cit->second.change : nullptr;
 }
 
 bool FragmentedChangePitStop::try_to_remove(const SequenceNumber_t& sequence_number, const GUID_t& writer_guid)
 {
-    bool returnedValue = false;
-
-    auto range = changes_.equal_range(ChangeInPit(sequence_number));
-
-    auto cit = range.first;
+    auto cit = changes_.find(ChangeKey{writer_guid, sequence_number});
 
-    // If there is a range, search the CacheChange_t with the same writer GUID_t.
-    if(cit != changes_.end())
+    if(cit == changes_.end())
     {
-        for(; cit != range.second; ++cit)
-        {
-            if(cit->getChange()->writerGUID == writer_guid)
-            {
-                // Destroy CacheChange_t.
-                parent_->releaseCache(cit->getChange());
-                changes_.erase(cit);
-                returnedValue = true;
-                break;
-            }
-        }
+        return false;
     }
 
-    return returnedValue;
+    // Destroy CacheChange_t.
+    parent_->releaseCache(cit->second.change);
+    changes_.erase(cit);
+    return true;
 }
 
 bool FragmentedChangePitStop::try_to_remove_until(const SequenceNumber_t& sequence_number, const GUID_t& writer_guid)
@@ -166,11 +120,11 @@ bool FragmentedChangePitStop::try_to_remove_until(const SequenceNumber_t& sequen
     auto cit = changes_.begin();
     while(cit != changes_.end())
     {
-        if(cit->getChange()->sequenceNumber < sequence_number &&
-                cit->getChange()->writerGUID == writer_guid)
+        if(cit->first.sequence_number < sequence_number &&
+                cit->first.writer_guid == writer_guid)
         {
             // Destroy CacheChange_t.
-            parent_->releaseCache(cit->getChange());
+            parent_->releaseCache(cit->second.change);
             cit = changes_.erase(cit);
             returnedValue = true;
         }
@@ -21,7 +21,7 @@
 #include <fastrtps/fastrtps_dll.h>
 #include <fastrtps/rtps/common/CacheChange.h>
 
-#include <unordered_set>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -37,65 +37,39 @@ class RTPSReader;
 class FragmentedChangePitStop
 {
     /*!
-     * @brief Objects used by FragmentedChangePitStop internally.
+     * @brief Key of a CacheChange_t being reassembled.
      */
-    class ChangeInPit
+    struct ChangeKey
     {
-    public:
-
-        /*!
-         * @brief Relates a CacheChange_t with this ChangeInPit.
-         * This constructor has to be used if the ChangeInPit will be used to be stored in a container.
-         * @param change Related CacheChange_t.
-         */
-        ChangeInPit(CacheChange_t* change)
-            : sequence_number_(change->sequenceNumber)
-            , change_(change)
-        {
-        }
-
-        /*!
-         * @brief Constructor used to generated a simple key for searching in a container.
-         * @param sequence_number SequenceNumber_t used as key.
-         * @remarks Not use this constructor if the object will be stored in a container.
-         */
-        ChangeInPit(const SequenceNumber_t &sequence_number)
-            : sequence_number_(sequence_number)
-            , change_(nullptr)
-        {
-        }
+        GUID_t writer_guid;
+        SequenceNumber_t sequence_number;
 
-        ChangeInPit(const ChangeInPit& cip)
-            : sequence_number_(cip.sequence_number_)
-            , change_(cip.change_)
+        bool operator==(const ChangeKey& key) const
         {
+            return sequence_number == key.sequence_number && writer_guid == key.writer_guid;
         }
+    };
 
-        CacheChange_t* getChange() const { return change_; }
-
-        bool operator==(const ChangeInPit& cip) const
+    /*!
+     * @brief Defined the STD hash function for ChangeKey.
+     */
+    struct ChangeKeyHash
+    {
+        std::size_t operator()(const ChangeKey& key) const
         {
-            return sequence_number_ == cip.sequence_number_;
+            return GUIDHash{}(key.writer_guid) ^ (SequenceNumberHash{}(key.sequence_number) * 2654435761u);
         }
+    };
 
-    private:
-
-        ChangeInPit& operator=(const ChangeInPit& cip) = delete;
-
-        const SequenceNumber_t sequence_number_;
-        CacheChange_t* change_;
-
-    public:
-        /*!
-         * @brief Defined the STD hash function for ChangeInPit.
-         */
-        struct ChangeInPitHash
-        {
-            std::size_t operator()(const ChangeInPit& cip) const
-            {
-                return SequenceNumberHash{}(cip.sequence_number_);
-            }
-        };
+    /*!
+     * @brief Objects used by FragmentedChangePitStop internally.
+     */
+    struct ChangeInPit
+    {
+        //! CacheChange_t where the fragments are being reassembled.
+        CacheChange_t* change;
+        //! Number of fragments not received yet.
+        uint32_t missing_fragments;
     };
 
     public:
@@ -148,7 +122,7 @@ bool try_to_remove_until(const SequenceNumber_t& sequence_number, const GUID_t&
 
 private:
 
-std::unordered_multiset<ChangeInPit, ChangeInPit::ChangeInPitHash> changes_;
+std::unordered_map<ChangeKey, ChangeInPit, ChangeKeyHash> changes_;
 
 RTPSReader* parent_;
 
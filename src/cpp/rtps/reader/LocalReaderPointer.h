@@ -0,0 +1,92 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalReaderPointer.h
+ */
+#ifndef _RTPS_READER_LOCALREADERPOINTER_H_
+#define _RTPS_READER_LOCALREADERPOINTER_H_
+
+#include <fastrtps/rtps/common/Guid.h>
+
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/*!
+ * @brief Reference to a reader living in the same process, used by writers to deliver changes to it directly.
+ *
+ * Writers keep it while the reader is matched. When the reader is going to be destroyed, the pointer is
+ * deactivated, waiting for the deliveries in progress, and any later access is ignored.
+ */
+class LocalReaderPointer
+{
+public:
+
+    LocalReaderPointer(
+            RTPSReader* reader,
+            const GUID_t& guid)
+        : reader_(reader)
+        , guid_(guid)
+    {
+    }
+
+    //! GUID of the reader.
+    const GUID_t& guid() const
+    {
+        return guid_;
+    }
+
+    /*!
+     * @brief Calls a functor with the reader, if it is still alive.
+     * @param f Functor receiving a RTPSReader& and returning bool.
+     * @return What the functor returned, or false if the reader is gone.
+     */
+    template<typename Functor>
+    bool with_reader(Functor f)
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        if (reader_ == nullptr)
+        {
+            return false;
+        }
+        return f(*reader_);
+    }
+
+    //! Forgets the reader, waiting until it is not being accessed.
+    void deactivate()
+    {
+        std::lock_guard<std::recursive_mutex> guard(mutex_);
+        reader_ = nullptr;
+    }
+
+private:
+
+    // Recursive, as a reader listener may delete other endpoints while being served.
+    std::recursive_mutex mutex_;
+
+    RTPSReader* reader_;
+
+    GUID_t guid_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_READER_LOCALREADERPOINTER_H_
@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/history/ReaderHistory.h>
 #include <fastrtps/rtps/reader/timedevent/HeartbeatResponseDelay.h>
 #include <fastrtps/rtps/reader/timedevent/InitialAckNack.h>
+#include <fastrtps/rtps/reader/timedevent/AckNackCoalescingDelay.h>
 #include <fastrtps/log/Log.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
 #include "../participant/RTPSParticipantImpl.h"
@@ -32,6 +33,7 @@
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
 #include <fastrtps/rtps/writer/LivelinessManager.h>
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
 
@@ -44,6 +46,17 @@ using namespace eprosima::fastrtps::rtps;
 StatefulReader::~StatefulReader()
 {
     logInfo(RTPS_READER,"StatefulReader destructor.";);
+
+    AckNackCoalescingDelay* acknack_coalescing = nullptr;
+    {
+        // Responses to heartbeats received from now on are sent right away.
+        std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+        acknack_coalescing = acknack_coalescing_;
+        acknack_coalescing_ = nullptr;
+        pending_acknacks_.clear();
+    }
+    delete(acknack_coalescing);
+
     for(std::vector<WriterProxy*>::iterator it = matched_writers.begin();
             it!=matched_writers.end();++it)
     {
@@ -67,7 +80,13 @@ StatefulReader::StatefulReader(
     , m_nackfragCount(0)
     , m_times(att.times)
     , disable_positive_acks_(att.disable_positive_acks)
+    , acknack_coalescing_(nullptr)
 {
+    if(m_times.acknackCoalescingWindow != c_TimeZero)
+    {
+        acknack_coalescing_ = new AckNackCoalescingDelay(this,
+                TimeConv::Duration_t2MilliSecondsDouble(m_times.acknackCoalescingWindow));
+    }
 }
 
 bool StatefulReader::matched_writer_add(RemoteWriterAttributes& wdata)
@@ -95,6 +114,7 @@ bool StatefulReader::matched_writer_add(RemoteWriterAttributes& wdata)
     add_persistence_guid(wdata);
     wp->loaded_from_storage_nts(get_last_notified(wdata.guid));
     matched_writers.push_back(wp);
+    mp_RTPSParticipant->matchedWriterAdded(this, wdata.guid);
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -147,6 +167,8 @@ bool StatefulReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
             logInfo(RTPS_READER,"Writer Proxy removed: " <<(*it)->m_att.guid);
             wproxy = *it;
             matched_writers.erase(it);
+            pending_acknacks_.erase(std::remove(pending_acknacks_.begin(), pending_acknacks_.end(), wproxy),
+                    pending_acknacks_.end());
             remove_persistence_guid(wdata);
             break;
         }
@@ -156,6 +178,7 @@ bool StatefulReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
 
     if(wproxy != nullptr)
     {
+        mp_RTPSParticipant->matchedWriterRemoved(this, wdata.guid);
         delete wproxy;
         return true;
     }
@@ -254,7 +277,13 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
 
             CacheChange_t* change_to_add;
 
-            if(reserveCache(&change_to_add, change->serializedPayload.length)) //Reserve a new cache from the corresponding cache pool
+            // A payload shared by several readers is referenced instead of copied
+            bool share_payload = change->has_shared_payload();
+#if HAVE_SECURITY
+            share_payload = share_payload && !getAttributes().security_attributes().is_payload_protected;
+#endif
+
+            if(reserveCache(&change_to_add, share_payload ? 0 : change->serializedPayload.length)) //Reserve a new cache from the corresponding cache pool
             {
 #if HAVE_SECURITY
                 if(getAttributes().security_attributes().is_payload_protected)
@@ -271,7 +300,11 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
                 else
                 {
 #endif
-                    if (!change_to_add->copy(change))
+                    if (share_payload)
+                    {
+                        change_to_add->copy_shared(change);
+                    }
+                    else if (!change_to_add->copy(change))
                     {
                         logWarning(RTPS_MSG_IN,IDSTRING"Problem copying CacheChange, received data is: " << change->serializedPayload.length
                                 << " bytes and max size in reader " << getGuid().entityId << " is " << change_to_add->serializedPayload.max_size);
@@ -731,6 +764,16 @@ bool StatefulReader::nextUnreadCache(
 bool StatefulReader::updateTimes(const ReaderTimes& ti)
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+
+    // Coalescing of acknacks can only be enabled or disabled when the reader is created.
+    Duration_t coalescing_window = m_times.acknackCoalescingWindow;
+    if(acknack_coalescing_ != nullptr && ti.acknackCoalescingWindow != c_TimeZero &&
+            coalescing_window != ti.acknackCoalescingWindow)
+    {
+        coalescing_window = ti.acknackCoalescingWindow;
+        acknack_coalescing_->update_interval(coalescing_window);
+    }
+
     if(m_times.heartbeatResponseDelay != ti.heartbeatResponseDelay)
     {
         m_times = ti;
@@ -740,9 +783,66 @@ bool StatefulReader::updateTimes(const ReaderTimes& ti)
             (*wit)->mp_heartbeatResponse->update_interval(m_times.heartbeatResponseDelay);
         }
     }
+
+    m_times.acknackCoalescingWindow = coalescing_window;
+    return true;
+}
+
+bool StatefulReader::delay_acknack(WriterProxy* wp)
+{
+    if(acknack_coalescing_ == nullptr)
+    {
+        return false;
+    }
+
+    if(std::find(pending_acknacks_.begin(), pending_acknacks_.end(), wp) == pending_acknacks_.end())
+    {
+        pending_acknacks_.push_back(wp);
+    }
+
+    acknack_coalescing_->restart_timer();
     return true;
 }
 
+void StatefulReader::send_delayed_acknacks(RTPSMessageGroup_t& buffers)
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+
+    if(pending_acknacks_.empty())
+    {
+        return;
+    }
+
+    logInfo(RTPS_READER, "Sending delayed responses to " << pending_acknacks_.size() << " writers");
+
+    try
+    {
+        // The group is flushed when the destination changes, so responses with the same locators are sent together.
+        RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::READER, buffers);
+
+        auto first = pending_acknacks_.begin();
+        while(first != pending_acknacks_.end())
+        {
+            const LocatorList_t& locators = (*first)->mp_heartbeatResponse->m_destination_locators;
+            auto last = std::stable_partition(first, pending_acknacks_.end(), [&locators](WriterProxy* wp)
+                    {
+                        return wp->mp_heartbeatResponse->m_destination_locators == locators;
+                    });
+
+            for(; first != last; ++first)
+            {
+                (*first)->mp_heartbeatResponse->add_response(group);
+            }
+        }
+    }
+    catch(const RTPSMessageGroup::timeout&)
+    {
+        logError(RTPS_READER, "Max blocking time reached");
+    }
+
+    pending_acknacks_.clear();
+}
+
 bool StatefulReader::isInCleanState()
 {
     bool cleanState = true;
@@ -759,3 +859,20 @@ bool StatefulReader::isInCleanState()
 
     return cleanState;
 }
+
+bool StatefulReader::get_acknack_base(
+        const GUID_t& writer_guid,
+        SequenceNumber_t& ack_base)
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+
+    WriterProxy* wp = nullptr;
+    if (!findWriterProxy(writer_guid, &wp))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::recursive_mutex> wp_guard(*wp->getMutex());
+    ack_base = wp->available_changes_max() + 1;
+    return true;
+}
@@ -77,6 +77,7 @@ bool StatelessReader::matched_writer_add(RemoteWriterAttributes& wdata)
     m_matched_writers.push_back(wdata);
     add_persistence_guid(wdata);
     m_acceptMessagesFromUnkownWriters = false;
+    mp_RTPSParticipant->matchedWriterAdded(this, wdata.guid);
 
     if (liveliness_lease_duration_ < c_TimeInfinite)
     {
@@ -126,6 +127,7 @@ bool StatelessReader::matched_writer_remove(const RemoteWriterAttributes& wdata)
 
             m_matched_writers.erase(it);
             remove_persistence_guid(wdata);
+            mp_RTPSParticipant->matchedWriterRemoved(this, wdata.guid);
 
             return true;
         }
@@ -263,7 +265,13 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
 
         CacheChange_t* change_to_add;
 
-        if(reserveCache(&change_to_add, change->serializedPayload.length)) //Reserve a new cache from the corresponding cache pool
+        // A payload shared by several readers is referenced instead of copied
+        bool share_payload = change->has_shared_payload();
+#if HAVE_SECURITY
+        share_payload = share_payload && !getAttributes().security_attributes().is_payload_protected;
+#endif
+
+        if(reserveCache(&change_to_add, share_payload ? 0 : change->serializedPayload.length)) //Reserve a new cache from the corresponding cache pool
         {
 #if HAVE_SECURITY
             if(getAttributes().security_attributes().is_payload_protected)
@@ -280,7 +288,11 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
             else
             {
 #endif
-                if (!change_to_add->copy(change))
+                if (share_payload)
+                {
+                    change_to_add->copy_shared(change);
+                }
+                else if (!change_to_add->copy(change))
                 {
                     logWarning(RTPS_MSG_IN,IDSTRING"Problem copying CacheChange, received data is: " << change->serializedPayload.length
                             << " bytes and max size in reader " << getGuid().entityId << " is " << change_to_add->serializedPayload.max_size);
@@ -23,6 +23,7 @@
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
 
+#include <algorithm>
 #include <mutex>
 
 #include <fastrtps/rtps/reader/timedevent/HeartbeatResponseDelay.h>
@@ -30,61 +31,61 @@
 
 using namespace eprosima::fastrtps::rtps;
 
-/*!
- * @brief Auxiliary function to change status in a range.
- */
-void WriterProxy::for_each_set_status_from(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
-        ChangeFromWriterStatus_t status,
-        ChangeFromWriterStatus_t new_status)
+void WriterProxy::add_change_nts(const ChangeFromWriter_t& change)
 {
-    auto it = first;
-    while(it != last)
-    {
-        if(it->getStatus() == status)
-        {
-            ChangeFromWriter_t newch(*it);
-            newch.setStatus(new_status);
+    assert(change.getSequenceNumber() == changesFromWLowMark_ + static_cast<uint32_t>(m_changesFromW.size() + 1));
 
-            auto hint = m_changesFromW.erase(it);
+    if(change.getStatus() == ChangeFromWriterStatus_t::MISSING)
+        ++missing_changes_count_;
 
-            it = m_changesFromW.insert(hint, newch);
-        }
+    m_changesFromW.push_back(change);
+}
 
-        ++it;
-    }
+void WriterProxy::remove_first_change_nts()
+{
+    const ChangeFromWriter_t& first = m_changesFromW.front();
+
+    if(first.getStatus() == ChangeFromWriterStatus_t::MISSING)
+        --missing_changes_count_;
+
+    changesFromWLowMark_ = first.getSequenceNumber();
+    m_changesFromW.pop_front();
 }
 
-void WriterProxy::for_each_set_status_from_and_maybe_remove(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
+ChangeFromWriter_t* WriterProxy::find_change_nts(const SequenceNumber_t& seq_num)
+{
+    if(seq_num <= changesFromWLowMark_)
+        return nullptr;
+
+    // Container holds consecutive sequence numbers, so the position is the distance to the low mark.
+    uint64_t pos = seq_num.to64long() - changesFromWLowMark_.to64long() - 1;
+
+    if(pos >= m_changesFromW.size())
+        return nullptr;
+
+    ChangeFromWriter_t* change = &m_changesFromW[static_cast<size_t>(pos)];
+    assert(change->getSequenceNumber() == seq_num);
+    return change;
+}
+
+/*!
+ * @brief Auxiliary function to change status in a range.
+ */
+void WriterProxy::set_status_nts(size_t count,
         ChangeFromWriterStatus_t status,
-        ChangeFromWriterStatus_t orstatus,
         ChangeFromWriterStatus_t new_status)
 {
-    auto it = first;
-    while(it != last)
+    for(size_t i = 0; i < count; ++i)
     {
-        if(it->getStatus() == status || it->getStatus() == orstatus)
+        ChangeFromWriter_t& ch = m_changesFromW[i];
+        if(ch.getStatus() == status)
         {
-            if(it != m_changesFromW.begin())
-            {
-                ChangeFromWriter_t newch(*it);
-                newch.setStatus(new_status);
-
-                auto hint = m_changesFromW.erase(it);
-
-                it = m_changesFromW.insert(hint, newch);
-                ++it;
-                continue;
-            }
-        }
+            if(status == ChangeFromWriterStatus_t::MISSING)
+                --missing_changes_count_;
+            if(new_status == ChangeFromWriterStatus_t::MISSING)
+                ++missing_changes_count_;
 
-        // UNKNOWN or MISSING at the beginning or
-        // LOST or RECEIVED at the beginning.
-        if(it == m_changesFromW.begin())
-        {
-            changesFromWLowMark_ = it->getSequenceNumber();
-            it = m_changesFromW.erase(it);
+            ch.setStatus(new_status);
         }
     }
 }
@@ -108,8 +109,8 @@ WriterProxy::WriterProxy(
     , mp_initialAcknack(nullptr)
     , m_heartbeatFinalFlag(false)
     , mp_mutex(new std::recursive_mutex())
+    , missing_changes_count_(0)
 {
-    m_changesFromW.clear();
     //Create Events
     mp_heartbeatResponse = new HeartbeatResponseDelay(
         this, TimeConv::Duration_t2MilliSecondsDouble(mp_SFR->getTimes().heartbeatResponseDelay));
@@ -134,11 +135,10 @@ void WriterProxy::missing_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(m_changesFromW.size() == 0 || m_changesFromW.back().getSequenceNumber() < seqNum)
         {
             // Set already values in container.
-            for_each_set_status_from(m_changesFromW.begin(), m_changesFromW.end(),
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
+            set_status_nts(m_changesFromW.size(), ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
 
             // Changes only already inserted values.
             bool will_be_the_last = maybe_add_changes_from_writer_up_to(seqNum, ChangeFromWriterStatus_t::MISSING);
@@ -148,15 +148,13 @@ void WriterProxy::missing_changes_update(const SequenceNumber_t& seqNum)
             // Add requetes sequence number.
             ChangeFromWriter_t newch(seqNum);
             newch.setStatus(ChangeFromWriterStatus_t::MISSING);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
+            add_change_nts(newch);
         }
         else
         {
-            // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
-            assert(last_it != m_changesFromW.end());
-            for_each_set_status_from(m_changesFromW.begin(), ++last_it,
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
+            // Sequence numbers are consecutive, so the requested one is at this position.
+            size_t count = static_cast<size_t>(seqNum.to64long() - changesFromWLowMark_.to64long());
+            set_status_nts(count, ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
         }
     }
 
@@ -171,7 +169,7 @@ bool WriterProxy::maybe_add_changes_from_writer_up_to(const SequenceNumber_t& se
     SequenceNumber_t lastSeqNum = changesFromWLowMark_;
 
     if(m_changesFromW.size() > 0)
-        lastSeqNum = m_changesFromW.rbegin()->getSequenceNumber();
+        lastSeqNum = m_changesFromW.back().getSequenceNumber();
 
     if(sequence_number > lastSeqNum)
     {
@@ -183,7 +181,7 @@ bool WriterProxy::maybe_add_changes_from_writer_up_to(const SequenceNumber_t& se
         {
             ChangeFromWriter_t newch(lastSeqNum);
             newch.setStatus(default_status);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
+            add_change_nts(newch);
         }
     }
 
@@ -198,21 +196,19 @@ void WriterProxy::lost_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(m_changesFromW.size() == 0 || m_changesFromW.back().getSequenceNumber() < seqNum)
         {
             // Remove all because lost or received.
             m_changesFromW.clear();
+            missing_changes_count_ = 0;
             // Any in container, then not insert new lost.
             changesFromWLowMark_ = seqNum - 1;
         }
         else
         {
-            // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
-            assert(last_it != m_changesFromW.end());
-            for_each_set_status_from_and_maybe_remove(m_changesFromW.begin(), last_it,
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING,
-                    ChangeFromWriterStatus_t::LOST);
+            // All previous changes are lost or received, so they are removed.
+            while(m_changesFromW.front().getSequenceNumber() < seqNum)
+                remove_first_change_nts();
             // Next could need to be removed.
             cleanup();
         }
@@ -255,7 +251,7 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
             ChangeFromWriter_t chfw(seqNum);
             chfw.setStatus(RECEIVED);
             chfw.setRelevance(is_relevance);
-            m_changesFromW.insert(m_changesFromW.end(), chfw);
+            add_change_nts(chfw);
         }
         // Else not insert
         else
@@ -264,22 +260,20 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
     // Else it has to be found and change state.
     else
     {
-        auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+        ChangeFromWriter_t* chit = find_change_nts(seqNum);
 
         // Has to be in the container.
-        assert(chit != m_changesFromW.end());
+        assert(chit != nullptr);
 
-        if(chit != m_changesFromW.begin())
+        if(chit != &m_changesFromW.front())
         {
             if(chit->getStatus() != RECEIVED)
             {
-                ChangeFromWriter_t newch(*chit);
-                newch.setStatus(RECEIVED);
-                newch.setRelevance(is_relevance);
+                if(chit->getStatus() == MISSING)
+                    --missing_changes_count_;
 
-                auto hint = m_changesFromW.erase(chit);
-
-                m_changesFromW.insert(hint, newch);
+                chit->setStatus(RECEIVED);
+                chit->setRelevance(is_relevance);
             }
             else
                 return false;
@@ -287,8 +281,7 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
         else
         {
             assert(chit->getStatus() != RECEIVED);
-            changesFromWLowMark_ = seqNum;
-            m_changesFromW.erase(chit);
+            remove_first_change_nts();
             cleanup();
         }
 
@@ -305,13 +298,19 @@ const std::vector<ChangeFromWriter_t> WriterProxy::missing_changes()
     std::vector<ChangeFromWriter_t> returnedValue;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    for(auto ch : m_changesFromW)
+    if(missing_changes_count_ > 0)
     {
-        if(ch.getStatus() == MISSING)
+        returnedValue.reserve(missing_changes_count_);
+
+        for(size_t i = 0; i < m_changesFromW.size(); ++i)
         {
-            // If MISSING, then is relevant.
-            assert(ch.isRelevant());
-            returnedValue.push_back(ch);
+            const ChangeFromWriter_t& ch = m_changesFromW[i];
+            if(ch.getStatus() == MISSING)
+            {
+                // If MISSING, then is relevant.
+                assert(ch.isRelevant());
+                returnedValue.push_back(ch);
+            }
         }
     }
 
@@ -328,9 +327,9 @@ bool WriterProxy::change_was_received(const SequenceNumber_t& seq_num)
     if(seq_num <= changesFromWLowMark_)
         return true;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seq_num));
+    const ChangeFromWriter_t* chit = find_change_nts(seq_num);
 
-    if(chit != m_changesFromW.end() && chit->getStatus() == RECEIVED)
+    if(chit != nullptr && chit->getStatus() == RECEIVED)
         return true;
 
     return false;
@@ -347,9 +346,10 @@ void WriterProxy::print_changes_fromWriter_test2()
     std::stringstream sstream;
     sstream << this->m_att.guid.entityId<<": ";
 
-    for(auto it = m_changesFromW.begin(); it != m_changesFromW.end(); ++it)
+    for(size_t i = 0; i < m_changesFromW.size(); ++i)
     {
-        sstream << it->getSequenceNumber() <<"("<<it->isRelevant()<<","<<it->getStatus()<<")-";
+        const ChangeFromWriter_t& ch = m_changesFromW[i];
+        sstream << ch.getSequenceNumber() <<"("<<ch.isRelevant()<<","<<ch.getStatus()<<")-";
     }
 
     std::string auxstr = sstream.str();
@@ -364,52 +364,33 @@ void WriterProxy::setNotValid(const SequenceNumber_t& seqNum)
     if(seqNum <= changesFromWLowMark_)
         return;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+    ChangeFromWriter_t* chit = find_change_nts(seqNum);
 
     // Element must be in the container. In other case, bug.
-    assert(chit != m_changesFromW.end());
+    assert(chit != nullptr);
     // If the element will be set not valid, element must be received.
     // In other case, bug.
     assert(chit->getStatus() == RECEIVED);
 
     // Cannot be in the beginning because process of cleanup
-    assert(chit != m_changesFromW.begin());
-
-    ChangeFromWriter_t newch(*chit);
-    newch.notValid();
+    assert(chit != &m_changesFromW.front());
 
-    auto hint = m_changesFromW.erase(chit);
-
-    m_changesFromW.insert(hint, newch);
+    chit->notValid();
 }
 
 void WriterProxy::cleanup()
 {
-    auto chit = m_changesFromW.begin();
-
-    while(chit != m_changesFromW.end() &&
-            (chit->getStatus() == RECEIVED || chit->getStatus() == LOST))
+    while(!m_changesFromW.empty() &&
+            (m_changesFromW.front().getStatus() == RECEIVED || m_changesFromW.front().getStatus() == LOST))
     {
-        changesFromWLowMark_ = chit->getSequenceNumber();
-        chit = m_changesFromW.erase(chit);
+        remove_first_change_nts();
     }
 }
 
 bool WriterProxy::areThereMissing()
 {
-    bool returnedValue = false;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-
-    for(auto ch : m_changesFromW)
-    {
-        if(ch.getStatus() == ChangeFromWriterStatus_t::MISSING)
-        {
-            returnedValue = true;
-            break;
-        }
-    }
-
-    return returnedValue;
+    return missing_changes_count_ > 0;
 }
 
 size_t WriterProxy::unknown_missing_changes_up_to(const SequenceNumber_t& seqNum)
@@ -419,10 +400,14 @@ size_t WriterProxy::unknown_missing_changes_up_to(const SequenceNumber_t& seqNum
 
     if(seqNum > changesFromWLowMark_)
     {
-        for(auto ch = m_changesFromW.begin(); ch != m_changesFromW.end() && ch->getSequenceNumber() < seqNum; ++ch)
+        uint64_t count = seqNum.to64long() - changesFromWLowMark_.to64long() - 1;
+        size_t last = static_cast<size_t>(std::min<uint64_t>(count, m_changesFromW.size()));
+
+        for(size_t i = 0; i < last; ++i)
         {
-            if(ch->getStatus() == ChangeFromWriterStatus_t::UNKNOWN ||
-                    ch->getStatus() == ChangeFromWriterStatus_t::MISSING)
+            const ChangeFromWriter_t& ch = m_changesFromW[i];
+            if(ch.getStatus() == ChangeFromWriterStatus_t::UNKNOWN ||
+                    ch.getStatus() == ChangeFromWriterStatus_t::MISSING)
                 ++returnedValue;
         }
     }
@@ -0,0 +1,73 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file AckNackCoalescingDelay.cpp
+ *
+ */
+
+#include <fastrtps/rtps/reader/timedevent/AckNackCoalescingDelay.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
+
+#include <fastrtps/rtps/reader/StatefulReader.h>
+#include "../../participant/RTPSParticipantImpl.h"
+
+#include <fastrtps/log/Log.h>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+AckNackCoalescingDelay::~AckNackCoalescingDelay()
+{
+    destroy();
+}
+
+AckNackCoalescingDelay::AckNackCoalescingDelay(
+        StatefulReader* reader,
+        double interval)
+    : TimedEvent(reader->getRTPSParticipant()->getEventResource().getIOService(),
+            reader->getRTPSParticipant()->getEventResource().getThread(), interval)
+    , mp_SFR(reader)
+    , m_cdrmessages(reader->getRTPSParticipant()->getMaxMessageSize(),
+            reader->getRTPSParticipant()->getGuid().guidPrefix)
+{
+}
+
+void AckNackCoalescingDelay::event(
+        EventCode code,
+        const char* msg)
+{
+
+    // Unused in release mode.
+    (void)msg;
+
+    if(code == EVENT_SUCCESS)
+    {
+        logInfo(RTPS_READER,"");
+        mp_SFR->send_delayed_acknacks(m_cdrmessages);
+    }
+    else if(code == EVENT_ABORT)
+    {
+        logInfo(RTPS_READER,"AckNackCoalescingDelay aborted");
+    }
+    else
+    {
+        logInfo(RTPS_READER,"AckNackCoalescingDelay event message: " <<msg);
+    }
+}
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
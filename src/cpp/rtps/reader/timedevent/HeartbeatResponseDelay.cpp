@@ -73,86 +73,17 @@ void HeartbeatResponseDelay::event(
         // Protect reader
         std::lock_guard<std::recursive_timed_mutex> guard(mp_WP->mp_SFR->getMutex());
 
-        const std::vector<ChangeFromWriter_t> missing_changes = mp_WP->missing_changes();
-        // Stores missing changes but there is some fragments received.
-        std::vector<CacheChange_t*> uncompleted_changes;
+        // The response is sent later, together with the ones to other writers, when acknacks are coalesced.
+        if(mp_WP->mp_SFR->delay_acknack(mp_WP))
+        {
+            return;
+        }
 
         try
         {
             RTPSMessageGroup group(mp_WP->mp_SFR->getRTPSParticipant(), mp_WP->mp_SFR, RTPSMessageGroup::READER,
                     m_cdrmessages, m_destination_locators, m_remote_endpoints);
-
-            if(!missing_changes.empty() || !mp_WP->m_heartbeatFinalFlag)
-            {
-                SequenceNumberSet_t sns(mp_WP->available_changes_max() + 1);
-
-                for(auto ch : missing_changes)
-                {
-                    // Check if the CacheChange_t is uncompleted.
-                    CacheChange_t* uncomplete_change = mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(ch.getSequenceNumber(), mp_WP->m_att.guid);
-
-                    if(uncomplete_change == nullptr)
-                    {
-                        if(!sns.add(ch.getSequenceNumber()))
-                        {
-                            logInfo(RTPS_READER,"Sequence number " << ch.getSequenceNumber()
-                                    << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base());
-                        }
-                    }
-                    else
-                    {
-                        uncompleted_changes.push_back(uncomplete_change);
-                    }
-                }
-
-                // TODO Protect
-                mp_WP->mp_SFR->m_acknackCount++;
-                logInfo(RTPS_READER,"Sending ACKNACK: "<< sns;);
-
-                bool final = sns.empty();
-                group.add_acknack(m_remote_endpoints, sns, mp_WP->mp_SFR->m_acknackCount, final, m_destination_locators);
-            }
-
-            // Now generage NACK_FRAGS
-            if(!uncompleted_changes.empty())
-            {
-                for(auto cit : uncompleted_changes)
-                {
-                    FragmentNumberSet_t frag_sns;
-
-                    //  Search first fragment not present.
-                    uint32_t frag_num = 0;
-                    auto fit = cit->getDataFragments()->begin();
-                    for(; fit != cit->getDataFragments()->end(); ++fit)
-                    {
-                        ++frag_num;
-                        if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                            break;
-                    }
-
-                    // Never should happend.
-                    assert(frag_num != 0);
-                    assert(fit != cit->getDataFragments()->end());
-
-                    // Store FragmentNumberSet_t base.
-                    frag_sns.base(frag_num);
-
-                    // Fill the FragmentNumberSet_t bitmap.
-                    for(; fit != cit->getDataFragments()->end(); ++fit)
-                    {
-                        if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
-                            frag_sns.add(frag_num);
-
-                        ++frag_num;
-                    }
-
-                    ++mp_WP->mp_SFR->m_nackfragCount;
-                    logInfo(RTPS_READER,"Sending NACKFRAG for sample" << cit->sequenceNumber << ": "<< frag_sns;);
-
-                    group.add_nackfrag(m_remote_endpoints, cit->sequenceNumber, frag_sns, mp_WP->mp_SFR->m_nackfragCount,
-                            m_destination_locators);
-                }
-            }
+            add_response(group);
         }
         catch(const RTPSMessageGroup::timeout&)
         {
@@ -169,6 +100,85 @@ void HeartbeatResponseDelay::event(
     }
 }
 
+void HeartbeatResponseDelay::add_response(RTPSMessageGroup& group)
+{
+    const std::vector<ChangeFromWriter_t> missing_changes = mp_WP->missing_changes();
+    // Stores missing changes but there is some fragments received.
+    std::vector<CacheChange_t*> uncompleted_changes;
+
+    if(!missing_changes.empty() || !mp_WP->m_heartbeatFinalFlag)
+    {
+        SequenceNumberSet_t sns(mp_WP->available_changes_max() + 1);
+
+        for(auto ch : missing_changes)
+        {
+            // Check if the CacheChange_t is uncompleted.
+            CacheChange_t* uncomplete_change = mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(ch.getSequenceNumber(), mp_WP->m_att.guid);
+
+            if(uncomplete_change == nullptr)
+            {
+                if(!sns.add(ch.getSequenceNumber()))
+                {
+                    logInfo(RTPS_READER,"Sequence number " << ch.getSequenceNumber()
+                            << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base());
+                }
+            }
+            else
+            {
+                uncompleted_changes.push_back(uncomplete_change);
+            }
+        }
+
+        // TODO Protect
+        mp_WP->mp_SFR->m_acknackCount++;
+        logInfo(RTPS_READER,"Sending ACKNACK: "<< sns;);
+
+        bool final = sns.empty();
+        group.add_acknack(m_remote_endpoints, sns, mp_WP->mp_SFR->m_acknackCount, final, m_destination_locators);
+    }
+
+    // Now generage NACK_FRAGS
+    if(!uncompleted_changes.empty())
+    {
+        for(auto cit : uncompleted_changes)
+        {
+            FragmentNumberSet_t frag_sns;
+
+            //  Search first fragment not present.
+            uint32_t frag_num = 0;
+            auto fit = cit->getDataFragments()->begin();
+            for(; fit != cit->getDataFragments()->end(); ++fit)
+            {
+                ++frag_num;
+                if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
+                    break;
+            }
+
+            // Never should happend.
+            assert(frag_num != 0);
+            assert(fit != cit->getDataFragments()->end());
+
+            // Store FragmentNumberSet_t base.
+            frag_sns.base(frag_num);
+
+            // Fill the FragmentNumberSet_t bitmap.
+            for(; fit != cit->getDataFragments()->end(); ++fit)
+            {
+                if(*fit == ChangeFragmentStatus_t::NOT_PRESENT)
+                    frag_sns.add(frag_num);
+
+                ++frag_num;
+            }
+
+            ++mp_WP->mp_SFR->m_nackfragCount;
+            logInfo(RTPS_READER,"Sending NACKFRAG for sample" << cit->sequenceNumber << ": "<< frag_sns;);
+
+            group.add_nackfrag(m_remote_endpoints, cit->sequenceNumber, frag_sns, mp_WP->mp_SFR->m_nackfragCount,
+                    m_destination_locators);
+        }
+    }
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
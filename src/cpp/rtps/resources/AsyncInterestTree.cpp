@@ -20,40 +20,35 @@
 using namespace eprosima::fastrtps::rtps;
 
 AsyncInterestTree::AsyncInterestTree():
-   mActiveInterest(&mInterestAlpha),
-   mHiddenInterest(&mInterestBeta)
+   mHead(nullptr)
 {
 }
 
-void AsyncInterestTree::RegisterInterest(const RTPSWriter* writer)
+bool AsyncInterestTree::RegisterInterest(const RTPSWriter* writer)
 {
-   std::unique_lock<std::mutex> guard(mMutexHidden);
-   mHiddenInterest->insert(writer); 
+   if (writer->async_interest_registered_.exchange(true, std::memory_order_acq_rel))
+   {
+      // Already in the list, pending to be taken.
+      return false;
+   }
+
+   const RTPSWriter* head = mHead.load(std::memory_order_relaxed);
+   do
+   {
+      writer->async_interest_next_ = head;
+   }
+   while (!mHead.compare_exchange_weak(head, writer, std::memory_order_release, std::memory_order_relaxed));
+
+   return true;
 }
 
-void AsyncInterestTree::RegisterInterest(const RTPSParticipantImpl* participant)
+bool AsyncInterestTree::RegisterInterest(const RTPSParticipantImpl* participant)
 {
    std::lock_guard<std::recursive_mutex> guard_participant(*participant->getParticipantMutex());
-   std::unique_lock<std::mutex> guard(mMutexHidden);
-   auto writers = participant->getAllWriters();
+   bool registered = false;
 
-   for (auto writer : writers)
-      mHiddenInterest->insert(writer); 
-}
-
-void AsyncInterestTree::Swap()
-{
-   std::unique_lock<std::mutex> activeGuard(mMutexActive);
-   std::unique_lock<std::mutex> hiddenGuard(mMutexHidden);
+   for (auto writer : participant->getAllWriters())
+      registered |= RegisterInterest(writer);
 
-   mActiveInterest->clear();
-   auto swap = mActiveInterest;
-   mActiveInterest = mHiddenInterest;
-   mHiddenInterest = swap;
-}
-
-std::set<const RTPSWriter*> AsyncInterestTree::GetInterestedWriters() const
-{
-   std::unique_lock<std::mutex> activeGuard(mMutexActive);
-   return *mActiveInterest;
+   return registered;
 }
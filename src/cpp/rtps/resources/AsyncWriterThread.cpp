@@ -14,119 +14,242 @@
 
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <mutex>
 
 #include <algorithm>
 #include <cassert>
-#include <stdexcept>
 
 using namespace eprosima::fastrtps::rtps;
 
-std::thread* AsyncWriterThread::thread_;
-std::mutex AsyncWriterThread::data_structure_mutex_;
-std::mutex AsyncWriterThread::condition_variable_mutex_;
-std::list<RTPSWriter*> AsyncWriterThread::async_writers;
-bool AsyncWriterThread::running_;
-bool AsyncWriterThread::run_scheduled_;
-std::condition_variable AsyncWriterThread::cv_;
-AsyncInterestTree AsyncWriterThread::interestTree;
-
 bool AsyncWriterThread::addWriter(RTPSWriter& writer)
 {
-    bool returnedValue = false;
+    return writer.getRTPSParticipant()->async_writer_thread().add_writer(writer);
+}
 
-    data_structure_mutex_.lock();
-    async_writers.push_back(&writer);
-    returnedValue = true;
+bool AsyncWriterThread::removeWriter(RTPSWriter& writer)
+{
+    return writer.getRTPSParticipant()->async_writer_thread().remove_writer(writer);
+}
 
-    std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-    data_structure_mutex_.unlock();
-    // If thread not running, start it.
-    if(thread_ == nullptr)
+void AsyncWriterThread::wakeUp(const RTPSParticipantImpl* interestedParticipant)
+{
+    AsyncWriterThread& pool = interestedParticipant->async_writer_thread();
+    if (pool.interestTree.RegisterInterest(interestedParticipant))
     {
-        running_ = true;
-        run_scheduled_ = true;
-        thread_ = new std::thread(AsyncWriterThread::run);
+        pool.wake_up();
     }
+}
 
-    return returnedValue;
+void AsyncWriterThread::wakeUp(const RTPSWriter* interestedWriter)
+{
+    AsyncWriterThread& pool = interestedWriter->getRTPSParticipant()->async_writer_thread();
+
+    // Threads only need to be woken up by the first interest on a writer since the last time it was taken.
+    if (pool.interestTree.RegisterInterest(interestedWriter))
+    {
+        pool.wake_up();
+    }
 }
 
-/*!
- * @brief This function removes a writer.
- * @param writer Asynchronous writer to be removed.
- * @return Result of the operation.
- */
-bool AsyncWriterThread::removeWriter(RTPSWriter& writer)
+AsyncWriterThread::AsyncWriterThread(uint32_t thread_count)
+    : thread_count_(std::max(thread_count, 1u))
+    , queues_(thread_count_)
+    , next_thread_(0)
+    , running_(false)
+    , run_scheduled_(false)
 {
-    bool returnedValue = false;
+}
 
-    std::unique_lock<std::mutex> data_guard(data_structure_mutex_);
-    auto it = std::find(async_writers.begin(), async_writers.end(), &writer);
+AsyncWriterThread::~AsyncWriterThread()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    running_ = false;
+    cv_.notify_all();
+    lock.unlock();
 
-    if(it != async_writers.end())
+    for (std::thread& thread : threads_)
     {
-        async_writers.erase(it);
-        returnedValue = true;
+        thread.join();
+    }
+}
 
-        // If there is not more asynchronous writers, stop the thread.
-        if(async_writers.empty())
+bool AsyncWriterThread::add_writer(RTPSWriter& writer)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    WriterState state{&writer, next_thread_, false, false, false};
+    if (!writers_.emplace(&writer, state).second)
+    {
+        return false;
+    }
+    next_thread_ = (next_thread_ + 1) % thread_count_;
+
+    // If threads are not running, start them.
+    if (threads_.empty())
+    {
+        running_ = true;
+        for (size_t i = 0; i < thread_count_; ++i)
         {
-            std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-            data_guard.unlock();
-            running_ = false;
-            run_scheduled_ = false;
-            cv_.notify_all();
-            cond_guard.unlock();
-            thread_->join();
-            cond_guard.lock();
-            delete thread_;
-            thread_ = nullptr;
+            threads_.emplace_back(&AsyncWriterThread::run, this, i);
         }
     }
 
-    return returnedValue;
+    return true;
 }
 
-void AsyncWriterThread::wakeUp(const RTPSParticipantImpl* interestedParticipant)
+bool AsyncWriterThread::remove_writer(RTPSWriter& writer)
 {
-   interestTree.RegisterInterest(interestedParticipant);
-   { // Lock scope
-      std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-      run_scheduled_ = true;
-   }
-   cv_.notify_all();
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // The interest list links writers through themselves, so the writer cannot be left in it. Timed events of the
+    // writer may still try to register it until they are destroyed, and that interest has to be ignored.
+    size_t scheduled = 0;
+    interestTree.RemoveWriter(&writer, [this, &scheduled](const RTPSWriter* interested)
+            {
+                if (schedule_interested_writer(interested))
+                {
+                    ++scheduled;
+                }
+            });
+    if (scheduled > 0)
+    {
+        cv_.notify_all();
+    }
+
+    auto it = writers_.find(&writer);
+    if (it == writers_.end())
+    {
+        return false;
+    }
+
+    // Wait for the thread currently sending on behalf of the writer.
+    WriterState& state = it->second;
+    writer_done_cv_.wait(lock, [&state]() { return !state.running; });
+
+    if (state.queued)
+    {
+        std::deque<WriterState*>& queue = queues_[state.thread];
+        queue.erase(std::find(queue.begin(), queue.end(), &state));
+    }
+
+    writers_.erase(it);
+    return true;
 }
 
-void AsyncWriterThread::wakeUp(const RTPSWriter* interestedWriter)
+void AsyncWriterThread::wake_up()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        run_scheduled_ = true;
+    }
+    cv_.notify_one();
+}
+
+size_t AsyncWriterThread::schedule_interested_writers()
 {
-   interestTree.RegisterInterest(interestedWriter);
-   std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-   run_scheduled_ = true;
-   cv_.notify_all();
+    run_scheduled_ = false;
+
+    size_t scheduled = 0;
+    interestTree.TakeInterestedWriters([this, &scheduled](const RTPSWriter* writer)
+            {
+                if (schedule_interested_writer(writer))
+                {
+                    ++scheduled;
+                }
+            });
+
+    return scheduled;
+}
+
+bool AsyncWriterThread::schedule_interested_writer(const RTPSWriter* writer)
+{
+    auto it = writers_.find(writer);
+    if (it != writers_.end() && !it->second.queued)
+    {
+        schedule(it->second);
+        return true;
+    }
+
+    return false;
 }
 
-void AsyncWriterThread::run()
+void AsyncWriterThread::schedule(WriterState& state)
 {
-    std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
-    while(running_)
-    {
-       if(run_scheduled_)
-       {
-          run_scheduled_ = false;
-          cond_guard.unlock();
-          interestTree.Swap();
-          auto interestedWriters = interestTree.GetInterestedWriters();
-
-          std::unique_lock<std::mutex> data_guard(data_structure_mutex_);
-          for(auto writer : async_writers)
-             if (interestedWriters.count(writer))
-               writer->send_any_unsent_changes();
-
-          cond_guard.lock();
-       }
-       else
-           cv_.wait(cond_guard);
+    if (state.running)
+    {
+        state.rerun = true;
+    }
+    else if (!state.queued)
+    {
+        state.queued = true;
+        queues_[state.thread].push_back(&state);
+    }
+}
+
+AsyncWriterThread::WriterState* AsyncWriterThread::take_writer(size_t index)
+{
+    WriterState* state = nullptr;
+
+    if (!queues_[index].empty())
+    {
+        state = queues_[index].front();
+        queues_[index].pop_front();
+    }
+    else
+    {
+        // Steal the most recently queued writer of another thread.
+        for (size_t i = 1; i < thread_count_; ++i)
+        {
+            std::deque<WriterState*>& queue = queues_[(index + i) % thread_count_];
+            if (!queue.empty())
+            {
+                state = queue.back();
+                queue.pop_back();
+                break;
+            }
+        }
+    }
+
+    if (state != nullptr)
+    {
+        state->queued = false;
+        state->running = true;
+    }
+
+    return state;
+}
+
+void AsyncWriterThread::run(size_t index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_)
+    {
+        // The calling thread takes one of the scheduled writers, the rest may be served by other threads.
+        if (run_scheduled_ && schedule_interested_writers() > 1)
+        {
+            cv_.notify_all();
+        }
+
+        WriterState* state = take_writer(index);
+        if (state != nullptr)
+        {
+            lock.unlock();
+            state->writer->send_any_unsent_changes();
+            lock.lock();
+
+            state->running = false;
+            if (state->rerun)
+            {
+                state->rerun = false;
+                schedule(*state);
+            }
+            writer_done_cv_.notify_all();
+        }
+        else
+        {
+            cv_.wait(lock);
+        }
     }
 }
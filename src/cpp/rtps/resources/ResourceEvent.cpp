@@ -18,6 +18,7 @@
  */
 
 #include <fastrtps/rtps/resources/ResourceEvent.h>
+#include "TimerWheel.h"
 
 #include <asio.hpp>
 #include <thread>
@@ -34,10 +35,12 @@ ResourceEvent::ResourceEvent():
     mp_b_thread(nullptr),
     mp_io_service(nullptr),
     mp_work(nullptr),
+    mp_timer_wheel(nullptr),
     mp_RTPSParticipantImpl(nullptr)
     {
         mp_io_service = new asio::io_service();
         mp_work = (void*)new asio::io_service::work(*mp_io_service);
+        mp_timer_wheel = &asio::use_service<TimerWheel>(*mp_io_service);
     }
 
 ResourceEvent::~ResourceEvent() {
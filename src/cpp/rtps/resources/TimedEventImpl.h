@@ -25,21 +25,13 @@
 
 #include <fastrtps/rtps/common/Time_t.h>
 #include <fastrtps/rtps/resources/TimedEvent.h>
+#include "TimerWheel.h"
 
-#include <memory>
-
-#include <asio/io_service.hpp>
-#include <asio/steady_timer.hpp>
-#include <asio/placeholders.hpp>
 #include <asio/io_service.hpp>
 
-#include <fastrtps/utils/Semaphore.h>
-
+#include <atomic>
+#include <chrono>
 #include <thread>
-#include <functional>
-#include <mutex>
-#include <condition_variable>
-#include <system_error>
 
 
 
@@ -49,11 +41,10 @@ namespace eprosima
     {
         namespace rtps
         {
-            class TimerState;
-
             /**
              * Timed Event class used to define any timed events.
              * All timedEvents must be a specification of this class, implementing the event method.
+             * The event is an entry on the TimerWheel of its io_service, so it does not own any timer nor lock.
              *@ingroup MANAGEMENT_MODULE
              */
             class TimedEventImpl
@@ -69,19 +60,18 @@ namespace eprosima
                     TimedEventImpl(TimedEvent* ev, asio::io_service &service, const std::thread& event_thread, std::chrono::microseconds interval, TimedEvent::AUTODESTRUCTION_MODE autodestruction);
 
                     /**
-                     * Method invoked when the event occurs. Abstract method.
-                     *
-                     * @param code Code representing the status of the event
-                     * @param msg Message associated to the event
+                     * Method invoked by the timer wheel when the event expires.
                      */
-                    void event(const std::error_code& ec, const std::shared_ptr<TimerState>& state);
+                    void event();
 
 
                 protected:
-                    //!Pointer to the timer.
-                    asio::steady_timer timer_;
+                    //!IO service where the event runs.
+                    asio::io_service& service_;
+                    //!Entry of the event on the timer wheel of the IO service.
+                    TimerWheel::Entry entry_;
                     //!Interval to be used in the timed Event.
-                    std::chrono::microseconds m_interval_microsec;
+                    std::atomic<std::chrono::microseconds> m_interval_microsec;
                     //!TimedEvent pointer
                     TimedEvent* mp_event;
 
@@ -117,7 +107,7 @@ namespace eprosima
                      */
                     double getIntervalMsec()
                     {
-                        auto total_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(m_interval_microsec);
+                        auto total_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(m_interval_microsec.load());
                         return static_cast<double>(total_milliseconds.count());
                     }
 
@@ -127,20 +117,13 @@ namespace eprosima
                      */
                     double getRemainingTimeMilliSec()
                     {
-                        std::unique_lock<std::mutex> lock(mutex_);
-                        return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(timer_.expires_from_now()).count());
+                        return static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    entry_.expiration() - TimerWheel::clock::now()).count());
                     }
 
                 private:
 
                     TimedEvent::AUTODESTRUCTION_MODE autodestruction_;
-                    //Duration_t m_timeInfinite;
-                    std::mutex mutex_;
-                    std::condition_variable cond_;
-
-                    std::shared_ptr<TimerState> state_;
-
-                    std::thread::id event_thread_id_;
             };
 
 
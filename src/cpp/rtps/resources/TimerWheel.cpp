@@ -0,0 +1,404 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerWheel.cpp
+ *
+ */
+
+#include "TimerWheel.h"
+
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+asio::io_service::id TimerWheel::id;
+
+constexpr uint32_t TimerWheel::c_bits_per_level;
+constexpr uint32_t TimerWheel::c_slots_per_level;
+constexpr uint64_t TimerWheel::c_slot_mask;
+constexpr uint32_t TimerWheel::c_levels;
+constexpr uint8_t TimerWheel::c_due_level;
+constexpr uint8_t TimerWheel::c_unscheduled_level;
+constexpr uint64_t TimerWheel::c_no_tick;
+
+//! Index of the lowest bit set on a non zero value
+static inline uint32_t lowest_bit(uint64_t value)
+{
+    assert(value != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+//! Index of the first bit set on a 64 bits map, starting from the given position and wrapping around
+static inline uint32_t first_bit_from(
+        uint64_t bitmap,
+        uint32_t position)
+{
+    uint64_t rotated = position == 0 ? bitmap : (bitmap >> position) | (bitmap << (64 - position));
+    return lowest_bit(rotated);
+}
+
+TimerWheel::Entry::Entry(
+        TimerWheel& wheel,
+        std::function<void()> callback)
+    : wheel_(wheel)
+    , callback_(callback)
+    , expiration_()
+    , tick_(0)
+    , prev_(nullptr)
+    , next_(nullptr)
+    , level_(c_unscheduled_level)
+    , slot_(0)
+    , enabled_(true)
+{
+}
+
+TimerWheel::Entry::~Entry()
+{
+    disable();
+}
+
+TimerWheel::TimerWheel(asio::io_service& service)
+    : asio::io_service::service(service)
+    , timer_(service)
+    , start_(clock::now())
+    , current_tick_(0)
+    , armed_tick_(c_no_tick)
+    , processing_(false)
+    , running_(nullptr)
+{
+    for (uint32_t level = 0; level <= c_levels; ++level)
+    {
+        occupied_[level] = 0;
+        for (uint32_t slot = 0; slot < c_slots_per_level; ++slot)
+        {
+            slots_[level][slot] = nullptr;
+        }
+    }
+}
+
+TimerWheel::~TimerWheel()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    timer_.cancel();
+}
+
+bool TimerWheel::schedule(
+        Entry& entry,
+        const clock::time_point& expiration,
+        bool replace)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (!entry.enabled_)
+    {
+        return false;
+    }
+
+    if (entry.level_ != c_unscheduled_level)
+    {
+        if (!replace)
+        {
+            return false;
+        }
+
+        unlink(entry);
+    }
+
+    entry.expiration_ = expiration;
+    entry.tick_ = to_tick(expiration);
+    insert(entry);
+
+    // When expired entries are being processed, the timer is armed once they are done.
+    if (!processing_)
+    {
+        uint64_t wake_tick = entry.level_ == c_due_level ? current_tick_ : entry.tick_;
+        if (wake_tick < armed_tick_)
+        {
+            arm(wake_tick);
+        }
+    }
+
+    return true;
+}
+
+bool TimerWheel::cancel(
+        Entry& entry,
+        bool wait_running)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool was_scheduled = entry.level_ != c_unscheduled_level;
+
+    if (was_scheduled)
+    {
+        unlink(entry);
+    }
+
+    if (wait_running)
+    {
+        entry.enabled_ = false;
+
+        while (running_ == &entry && running_thread_ != std::this_thread::get_id())
+        {
+            cond_.wait(lock);
+        }
+    }
+
+    return was_scheduled;
+}
+
+bool TimerWheel::is_scheduled(const Entry& entry) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return entry.level_ != c_unscheduled_level;
+}
+
+TimerWheel::clock::time_point TimerWheel::expiration(const Entry& entry) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return entry.expiration_;
+}
+
+void TimerWheel::insert(Entry& entry)
+{
+    if (entry.tick_ <= current_tick_)
+    {
+        link(entry, c_due_level, 0);
+        return;
+    }
+
+    uint64_t delta = entry.tick_ - current_tick_;
+    uint64_t placement_tick = entry.tick_;
+    uint32_t level = 0;
+
+    while (level < c_levels - 1 && delta >= (uint64_t(1) << (c_bits_per_level * (level + 1))))
+    {
+        ++level;
+    }
+
+    // Entries beyond the last level are placed on its furthest slot, and placed again when it is cascaded.
+    uint64_t horizon = uint64_t(1) << (c_bits_per_level * c_levels);
+    if (delta >= horizon)
+    {
+        placement_tick = current_tick_ + horizon - 1;
+    }
+
+    uint8_t slot = static_cast<uint8_t>((placement_tick >> (c_bits_per_level * level)) & c_slot_mask);
+    link(entry, static_cast<uint8_t>(level), slot);
+}
+
+void TimerWheel::link(
+        Entry& entry,
+        uint8_t level,
+        uint8_t slot)
+{
+    Entry*& head = slots_[level][slot];
+    entry.prev_ = nullptr;
+    entry.next_ = head;
+    if (head != nullptr)
+    {
+        head->prev_ = &entry;
+    }
+    head = &entry;
+
+    entry.level_ = level;
+    entry.slot_ = slot;
+    occupied_[level] |= uint64_t(1) << slot;
+}
+
+void TimerWheel::unlink(Entry& entry)
+{
+    Entry*& head = slots_[entry.level_][entry.slot_];
+
+    if (entry.prev_ != nullptr)
+    {
+        entry.prev_->next_ = entry.next_;
+    }
+    else
+    {
+        head = entry.next_;
+    }
+
+    if (entry.next_ != nullptr)
+    {
+        entry.next_->prev_ = entry.prev_;
+    }
+
+    if (head == nullptr)
+    {
+        occupied_[entry.level_] &= ~(uint64_t(1) << entry.slot_);
+    }
+
+    entry.prev_ = nullptr;
+    entry.next_ = nullptr;
+    entry.level_ = c_unscheduled_level;
+}
+
+void TimerWheel::advance(uint64_t target_tick)
+{
+    while (current_tick_ < target_tick)
+    {
+        // Ticks without slots to process are skipped.
+        uint64_t tick = next_tick();
+        if (tick > target_tick)
+        {
+            current_tick_ = target_tick;
+            break;
+        }
+
+        current_tick_ = tick;
+
+        for (uint32_t level = c_levels - 1; level > 0; --level)
+        {
+            uint32_t shift = c_bits_per_level * level;
+            if ((current_tick_ & ((uint64_t(1) << shift) - 1)) == 0)
+            {
+                uint8_t slot = static_cast<uint8_t>((current_tick_ >> shift) & c_slot_mask);
+                Entry* entry = slots_[level][slot];
+                slots_[level][slot] = nullptr;
+                occupied_[level] &= ~(uint64_t(1) << slot);
+
+                while (entry != nullptr)
+                {
+                    Entry* next = entry->next_;
+                    insert(*entry);
+                    entry = next;
+                }
+            }
+        }
+
+        uint8_t slot = static_cast<uint8_t>(current_tick_ & c_slot_mask);
+        Entry* entry = slots_[0][slot];
+        slots_[0][slot] = nullptr;
+        occupied_[0] &= ~(uint64_t(1) << slot);
+
+        while (entry != nullptr)
+        {
+            Entry* next = entry->next_;
+            link(*entry, c_due_level, 0);
+            entry = next;
+        }
+    }
+}
+
+uint64_t TimerWheel::next_tick() const
+{
+    uint64_t tick = c_no_tick;
+
+    if (occupied_[0] != 0)
+    {
+        uint64_t first = current_tick_ + 1;
+        tick = first + first_bit_from(occupied_[0], static_cast<uint32_t>(first & c_slot_mask));
+    }
+
+    for (uint32_t level = 1; level < c_levels; ++level)
+    {
+        if (occupied_[level] != 0)
+        {
+            // Slots on upper levels are processed when the lower levels wrap around.
+            uint32_t shift = c_bits_per_level * level;
+            uint64_t first = (current_tick_ >> shift) + 1;
+            uint64_t cascade_tick =
+                (first + first_bit_from(occupied_[level], static_cast<uint32_t>(first & c_slot_mask))) << shift;
+            if (cascade_tick < tick)
+            {
+                tick = cascade_tick;
+            }
+        }
+    }
+
+    return tick;
+}
+
+uint64_t TimerWheel::to_tick(const clock::time_point& time_point) const
+{
+    if (time_point <= start_)
+    {
+        return 0;
+    }
+
+    // Round up, so entries never expire before their time.
+    auto elapsed = time_point - start_;
+    auto ticks = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+    if (ticks < elapsed)
+    {
+        ++ticks;
+    }
+    return static_cast<uint64_t>(ticks.count());
+}
+
+void TimerWheel::arm(uint64_t tick)
+{
+    armed_tick_ = tick;
+    timer_.expires_at(start_ + std::chrono::milliseconds(tick));
+    timer_.async_wait(std::bind(&TimerWheel::on_timer, this, std::placeholders::_1));
+}
+
+void TimerWheel::on_timer(const std::error_code& ec)
+{
+    if (ec == asio::error::operation_aborted)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    armed_tick_ = c_no_tick;
+    processing_ = true;
+    running_thread_ = std::this_thread::get_id();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start_);
+    advance(static_cast<uint64_t>(elapsed.count()));
+
+    Entry* entry;
+    while ((entry = slots_[c_due_level][0]) != nullptr)
+    {
+        unlink(*entry);
+
+        // The callback is copied, so it may destroy its own entry.
+        std::function<void()> callback = entry->callback_;
+        running_ = entry;
+
+        lock.unlock();
+        callback();
+        lock.lock();
+
+        running_ = nullptr;
+        cond_.notify_all();
+    }
+
+    processing_ = false;
+
+    uint64_t tick = next_tick();
+    if (tick != c_no_tick)
+    {
+        arm(tick);
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
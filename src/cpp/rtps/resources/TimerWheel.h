@@ -0,0 +1,260 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimerWheel.h
+ *
+ */
+
+#ifndef TIMERWHEEL_H_
+#define TIMERWHEEL_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <asio/io_service.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Hierarchical timer wheel, used to run a large number of timed callbacks with a single asio timer.
+ *
+ * Entries are kept in four levels of 64 slots each, with a resolution of one millisecond on the first level.
+ * Scheduling and cancelling an entry are constant time operations, and entries on upper levels are moved down
+ * as the wheel advances. Every entry due when the wheel wakes up is run on the same wakeup, in the thread of the
+ * io_service.
+ *
+ * The wheel is an asio service, so there is a single one per io_service, obtained with
+ * asio::use_service<TimerWheel>(service).
+ * @ingroup MANAGEMENT_MODULE
+ */
+class TimerWheel : public asio::io_service::service
+{
+public:
+
+    //! Identifier of the service
+    static asio::io_service::id id;
+
+    typedef std::chrono::steady_clock clock;
+
+    /**
+     * A callback that can be scheduled on a TimerWheel.
+     * Entries are owned by the user and must be destroyed before the wheel.
+     */
+    class Entry
+    {
+    public:
+
+        /**
+         * @param wheel Wheel where the entry will be scheduled.
+         * @param callback Function called when the entry expires.
+         */
+        Entry(
+                TimerWheel& wheel,
+                std::function<void()> callback);
+
+        //! Cancels the entry, waiting for its callback if it is running on another thread.
+        ~Entry();
+
+        Entry(const Entry&) = delete;
+
+        Entry& operator=(const Entry&) = delete;
+
+        /**
+         * Schedules the entry, replacing any previous expiration time.
+         * @param expiration Time point when the callback should be called.
+         */
+        void schedule(const clock::time_point& expiration)
+        {
+            wheel_.schedule(*this, expiration, true);
+        }
+
+        /**
+         * Schedules the entry only if it is not already scheduled.
+         * @param expiration Time point when the callback should be called.
+         * @return true if the entry has been scheduled by this call.
+         */
+        bool start(const clock::time_point& expiration)
+        {
+            return wheel_.schedule(*this, expiration, false);
+        }
+
+        /**
+         * Cancels the entry. A callback already running is not waited for.
+         * @return true if the entry was scheduled.
+         */
+        bool cancel()
+        {
+            return wheel_.cancel(*this, false);
+        }
+
+        /**
+         * Cancels the entry and waits for its callback to finish, if it is running on another thread.
+         * The entry cannot be scheduled again afterwards.
+         * It should not be called while holding a lock taken by the callback.
+         */
+        void disable()
+        {
+            wheel_.cancel(*this, true);
+        }
+
+        /**
+         * @return true if the entry is scheduled and has not expired yet.
+         */
+        bool is_scheduled() const
+        {
+            return wheel_.is_scheduled(*this);
+        }
+
+        /**
+         * @return The expiration time given on the last call to schedule.
+         */
+        clock::time_point expiration() const
+        {
+            return wheel_.expiration(*this);
+        }
+
+    private:
+
+        friend class TimerWheel;
+
+        TimerWheel& wheel_;
+
+        std::function<void()> callback_;
+
+        clock::time_point expiration_;
+
+        //! Expiration time in ticks of the wheel
+        uint64_t tick_;
+
+        Entry* prev_;
+
+        Entry* next_;
+
+        uint8_t level_;
+
+        uint8_t slot_;
+
+        //! Whether the entry can be scheduled, cleared by disable()
+        bool enabled_;
+    };
+
+    /**
+     * @param service IO service where the expired entries are run.
+     */
+    explicit TimerWheel(asio::io_service& service);
+
+    ~TimerWheel();
+
+    //! Pending waits of the asio timer are destroyed by its own service.
+    void shutdown_service() override
+    {
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+private:
+
+    static constexpr uint32_t c_bits_per_level = 6;
+    static constexpr uint32_t c_slots_per_level = 1u << c_bits_per_level;
+    static constexpr uint64_t c_slot_mask = c_slots_per_level - 1;
+    static constexpr uint32_t c_levels = 4;
+    //! Pseudo level holding the entries that have expired and wait for their callback to be called
+    static constexpr uint8_t c_due_level = c_levels;
+    //! Pseudo level of the entries that are not scheduled
+    static constexpr uint8_t c_unscheduled_level = 0xFF;
+    static constexpr uint64_t c_no_tick = UINT64_MAX;
+
+    bool schedule(
+            Entry& entry,
+            const clock::time_point& expiration,
+            bool replace);
+
+    bool cancel(
+            Entry& entry,
+            bool wait_running);
+
+    bool is_scheduled(const Entry& entry) const;
+
+    clock::time_point expiration(const Entry& entry) const;
+
+    //! Places an entry on the slot corresponding to its expiration tick
+    void insert(Entry& entry);
+
+    void link(
+            Entry& entry,
+            uint8_t level,
+            uint8_t slot);
+
+    void unlink(Entry& entry);
+
+    //! Moves the wheel up to the given tick, cascading upper levels and moving expired entries to the due list
+    void advance(uint64_t target_tick);
+
+    //! Returns the next tick where a slot has to be cascaded or expired, or c_no_tick if the wheel is empty
+    uint64_t next_tick() const;
+
+    uint64_t to_tick(const clock::time_point& time_point) const;
+
+    //! Starts the asio timer to wake up on the given tick
+    void arm(uint64_t tick);
+
+    void on_timer(const std::error_code& ec);
+
+    asio::steady_timer timer_;
+
+    //! Time point corresponding to tick 0
+    const clock::time_point start_;
+
+    //! Last tick processed by the wheel
+    uint64_t current_tick_;
+
+    //! Tick where the asio timer will wake up, or c_no_tick if it is not waiting
+    uint64_t armed_tick_;
+
+    //! Whether expired entries are being processed, so scheduling does not need to arm the timer
+    bool processing_;
+
+    //! Entry whose callback is running
+    Entry* running_;
+
+    std::thread::id running_thread_;
+
+    Entry* slots_[c_levels + 1][c_slots_per_level];
+
+    //! Bitmap of non empty slots on each level
+    uint64_t occupied_[c_levels + 1];
+
+    mutable std::mutex mutex_;
+
+    std::condition_variable cond_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* TIMERWHEEL_H_ */
@@ -0,0 +1,251 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatScheduler.cpp
+ *
+ */
+
+#include "HeartbeatScheduler.h"
+
+#include "../participant/RTPSParticipantImpl.h"
+
+#include <fastrtps/rtps/resources/ResourceEvent.h>
+#include <fastrtps/rtps/writer/StatefulWriter.h>
+#include <fastrtps/log/Log.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Heartbeat messages are kept below the usual Ethernet MTU, so they are not fragmented by IP.
+static constexpr uint32_t c_max_heartbeat_message_size = 1400;
+
+static HeartbeatScheduler::clock::duration to_duration(const Duration_t& duration)
+{
+    return std::chrono::duration_cast<HeartbeatScheduler::clock::duration>(
+        std::chrono::nanoseconds(duration.to_ns()));
+}
+
+HeartbeatScheduler::HeartbeatScheduler(
+        RTPSParticipantImpl* participant,
+        const Duration_t& period)
+    : participant_(participant)
+    , period_(to_duration(period))
+    , start_(clock::now())
+    , timer_(participant->getEventResource().get_timer_wheel(), std::bind(&HeartbeatScheduler::on_timer, this))
+    , used_destinations_(0)
+    , processing_(false)
+{
+}
+
+HeartbeatScheduler::~HeartbeatScheduler()
+{
+    // Wait for a wakeup in progress before destroying the destinations.
+    timer_.disable();
+}
+
+void HeartbeatScheduler::register_writer(StatefulWriter* writer)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    WriterState state;
+    state.active = false;
+    state.due = due_.end();
+    state.heartbeat_period = clock::duration::zero();
+    writers_.emplace(writer, state);
+}
+
+void HeartbeatScheduler::unregister_writer(StatefulWriter* writer)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = writers_.find(writer);
+    if (it != writers_.end())
+    {
+        if (it->second.active)
+        {
+            due_.erase(it->second.due);
+        }
+        writers_.erase(it);
+    }
+
+    // Messages being built may reference the writer, so wait for them to be sent.
+    while (processing_ && processing_thread_ != std::this_thread::get_id())
+    {
+        cond_.wait(lock);
+    }
+}
+
+void HeartbeatScheduler::activate(
+        StatefulWriter* writer,
+        const Duration_t& heartbeat_period)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = writers_.find(writer);
+    if (it != writers_.end() && !it->second.active)
+    {
+        it->second.heartbeat_period = to_duration(heartbeat_period);
+        schedule_nts(writer, it->second);
+    }
+}
+
+void HeartbeatScheduler::deactivate(StatefulWriter* writer)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = writers_.find(writer);
+    if (it != writers_.end() && it->second.active)
+    {
+        due_.erase(it->second.due);
+        it->second.active = false;
+    }
+}
+
+void HeartbeatScheduler::schedule_nts(
+        StatefulWriter* writer,
+        WriterState& state)
+{
+    clock::time_point due_time = clock::now() + state.heartbeat_period;
+
+    // Round up to the next multiple of the coalescing period.
+    if (period_ > clock::duration::zero())
+    {
+        auto periods = (due_time - start_ + period_ - clock::duration(1)) / period_;
+        due_time = start_ + periods * period_;
+    }
+
+    state.due = due_.emplace(due_time, writer);
+    state.active = true;
+
+    if (state.due == due_.begin())
+    {
+        timer_.schedule(due_time);
+    }
+}
+
+RTPSMessageGroup& HeartbeatScheduler::message_group(
+        StatefulWriter* writer,
+        const LocatorList_t& locators)
+{
+    Destination* destination = nullptr;
+
+    for (size_t i = 0; i < used_destinations_; ++i)
+    {
+        if (destinations_[i]->locators == locators)
+        {
+            destination = destinations_[i].get();
+            break;
+        }
+    }
+
+    if (destination == nullptr)
+    {
+        if (used_destinations_ == destinations_.size())
+        {
+            destinations_.emplace_back(new Destination(
+                    std::min(participant_->getMaxMessageSize(), c_max_heartbeat_message_size),
+                    participant_->getGuid().guidPrefix));
+        }
+
+        destination = destinations_[used_destinations_++].get();
+        destination->locators = locators;
+        destination->group.reset(new RTPSMessageGroup(participant_, writer, RTPSMessageGroup::WRITER,
+                destination->buffers));
+    }
+
+    destination->group->set_endpoint(writer);
+    return *destination->group;
+}
+
+void HeartbeatScheduler::send_destinations()
+{
+    for (size_t i = 0; i < used_destinations_; ++i)
+    {
+        // The message is sent when the group is destroyed.
+        RTPSMessageGroup* group = destinations_[i]->group.release();
+        try
+        {
+            delete group;
+        }
+        catch(const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+
+    used_destinations_ = 0;
+}
+
+void HeartbeatScheduler::on_timer()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    processing_ = true;
+    processing_thread_ = std::this_thread::get_id();
+
+    clock::time_point now = clock::now();
+    serving_.clear();
+    while (!due_.empty() && due_.begin()->first <= now)
+    {
+        StatefulWriter* writer = due_.begin()->second;
+        writers_.at(writer).active = false;
+        due_.erase(due_.begin());
+        serving_.push_back(writer);
+    }
+
+    lock.unlock();
+
+    // Writers still waiting for acknowledgements are kept to be scheduled again.
+    size_t pending = 0;
+    for (StatefulWriter* writer : serving_)
+    {
+        if (writer->send_coalesced_heartbeat(*this))
+        {
+            serving_[pending++] = writer;
+        }
+    }
+
+    logInfo(RTPS_WRITER, "Heartbeats of " << serving_.size() << " writers sent to "
+            << used_destinations_ << " destinations");
+    send_destinations();
+    serving_.resize(pending);
+
+    lock.lock();
+
+    for (StatefulWriter* writer : serving_)
+    {
+        auto it = writers_.find(writer);
+        if (it != writers_.end() && !it->second.active)
+        {
+            schedule_nts(writer, it->second);
+        }
+    }
+
+    processing_ = false;
+    cond_.notify_all();
+
+    if (!due_.empty())
+    {
+        timer_.schedule(due_.begin()->first);
+    }
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
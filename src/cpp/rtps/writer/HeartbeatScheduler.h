@@ -0,0 +1,189 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatScheduler.h
+ *
+ */
+
+#ifndef HEARTBEATSCHEDULER_H_
+#define HEARTBEATSCHEDULER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "../resources/TimerWheel.h"
+
+#include <fastrtps/rtps/common/Locator.h>
+#include <fastrtps/rtps/common/Time_t.h>
+#include <fastrtps/rtps/messages/RTPSMessageGroup.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+class StatefulWriter;
+
+/**
+ * Participant level scheduler of the periodic heartbeats of the stateful writers.
+ *
+ * The heartbeat period of each writer is rounded up to the next multiple of the coalescing period, so writers
+ * with pending acknowledgements are due at the same time. All the writers due on a wakeup add their heartbeats
+ * to a message group per destination, and each of those groups is sent as a single message.
+ * @ingroup WRITER_MODULE
+ */
+class HeartbeatScheduler
+{
+public:
+
+    typedef std::chrono::steady_clock clock;
+
+    /**
+     * @param participant Participant whose writers are served.
+     * @param period Period the heartbeats are aligned to.
+     */
+    HeartbeatScheduler(
+            RTPSParticipantImpl* participant,
+            const Duration_t& period);
+
+    ~HeartbeatScheduler();
+
+    HeartbeatScheduler(const HeartbeatScheduler&) = delete;
+
+    HeartbeatScheduler& operator=(const HeartbeatScheduler&) = delete;
+
+    /**
+     * Adds a writer to the scheduler. Its heartbeats are not sent until activate is called.
+     * @param writer Writer to add.
+     */
+    void register_writer(StatefulWriter* writer);
+
+    /**
+     * Removes a writer from the scheduler, waiting for its heartbeats to be sent if it is being served.
+     * @param writer Writer to remove.
+     */
+    void unregister_writer(StatefulWriter* writer);
+
+    /**
+     * Schedules the periodic heartbeat of a writer, unless it is already scheduled.
+     * @param writer Writer whose heartbeat is scheduled.
+     * @param heartbeat_period Heartbeat period of the writer.
+     */
+    void activate(
+            StatefulWriter* writer,
+            const Duration_t& heartbeat_period);
+
+    /**
+     * Cancels the periodic heartbeat of a writer.
+     * @param writer Writer whose heartbeat is cancelled.
+     */
+    void deactivate(StatefulWriter* writer);
+
+    /**
+     * Gets the message group for a destination, where a writer being served adds its heartbeats.
+     * @param writer Writer adding submessages to the group.
+     * @param locators Destination locators.
+     * @return Message group shared by all the writers sending to the same locators.
+     */
+    RTPSMessageGroup& message_group(
+            StatefulWriter* writer,
+            const LocatorList_t& locators);
+
+private:
+
+    //! Message group and buffers used for a destination
+    struct Destination
+    {
+        Destination(
+                uint32_t max_message_size,
+                const GuidPrefix_t& guid_prefix)
+            : buffers(max_message_size, guid_prefix)
+        {
+        }
+
+        LocatorList_t locators;
+
+        RTPSMessageGroup_t buffers;
+
+        std::unique_ptr<RTPSMessageGroup> group;
+    };
+
+    typedef std::multimap<clock::time_point, StatefulWriter*> DueMap;
+
+    //! Scheduling state of a registered writer
+    struct WriterState
+    {
+        bool active;
+
+        DueMap::iterator due;
+
+        clock::duration heartbeat_period;
+    };
+
+    //! Called on the event thread when writers are due
+    void on_timer();
+
+    //! Schedules a writer at the next aligned time after its period. Called with the mutex locked.
+    void schedule_nts(
+            StatefulWriter* writer,
+            WriterState& state);
+
+    //! Sends the messages of all the destinations used on a wakeup
+    void send_destinations();
+
+    RTPSParticipantImpl* participant_;
+
+    const clock::duration period_;
+
+    //! Time point the due times are aligned to
+    const clock::time_point start_;
+
+    TimerWheel::Entry timer_;
+
+    std::unordered_map<StatefulWriter*, WriterState> writers_;
+
+    DueMap due_;
+
+    //! Writers being served on the current wakeup
+    std::vector<StatefulWriter*> serving_;
+
+    //! Destinations reused between wakeups
+    std::vector<std::unique_ptr<Destination>> destinations_;
+
+    //! Number of destinations used on the current wakeup
+    size_t used_destinations_;
+
+    bool processing_;
+
+    std::thread::id processing_thread_;
+
+    std::mutex mutex_;
+
+    std::condition_variable cond_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* HEARTBEATSCHEDULER_H_ */
@@ -20,9 +20,11 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/log/Log.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
+#include "../RTPSDomainImpl.h"
 
 #include <mutex>
 
@@ -56,6 +58,9 @@ RTPSWriter::RTPSWriter(
 #endif
     , liveliness_kind_(att.liveliness_kind)
     , liveliness_lease_duration_(att.liveliness_lease_duration)
+    , flow_controller_priority_(att.throughputController.priority)
+    , async_interest_registered_(false)
+    , async_interest_next_(nullptr)
 {
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
@@ -197,7 +202,8 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
             +20 /*SecureDataHeader*/ + 4 + ((2 * 16) /*EVP_MAX_IV_LENGTH max block size*/ - 1) /* SecureDataBodey*/
             + 16 + 4 /*SecureDataTag*/ &&
             (mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE ||
-                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE))
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
         {
             encrypt_payload_.data = (octet*)realloc(encrypt_payload_.data, change->serializedPayload.length +
                     // In future v2 changepool is in writer, and writer set this value to cachechagepool.
@@ -236,6 +242,51 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
 }
 #endif
 
+std::shared_ptr<LocalReaderPointer> RTPSWriter::find_local_reader(const GUID_t& reader_guid) const
+{
+    if (!mp_RTPSParticipant->getRTPSParticipantAttributes().intraprocessDelivery)
+    {
+        return nullptr;
+    }
+
+#if HAVE_SECURITY
+    // Protected writers keep using the transports, so every message goes through the security plugins
+    if (m_att.security_attributes().is_submessage_protected ||
+        m_att.security_attributes().is_payload_protected)
+    {
+        return nullptr;
+    }
+#endif
+
+    return RTPSDomainImpl::find_local_reader(reader_guid);
+}
+
+std::shared_ptr<CacheChange_t> RTPSWriter::copy_for_local_delivery(CacheChange_t* change)
+{
+    // Sharing the payload of the change once lets every local reader reference it too.
+    if (!change->make_shared_payload())
+    {
+        logWarning(RTPS_WRITER, "Cannot share the payload of change " << change->sequenceNumber);
+        return nullptr;
+    }
+
+    std::shared_ptr<CacheChange_t> copy = std::make_shared<CacheChange_t>();
+    copy->copy_shared(change);
+    // Delivered whole, as a DATA submessage.
+    copy->setFragmentSize(0);
+    return copy;
+}
+
+bool RTPSWriter::intraprocess_delivery(
+        CacheChange_t* change,
+        LocalReaderPointer& local_reader)
+{
+    return local_reader.with_reader([change](RTPSReader& reader)
+    {
+        return reader.processDataMsg(change);
+    });
+}
+
 const LivelinessQosPolicyKind& RTPSWriter::get_liveliness_kind() const
 {
     return liveliness_kind_;
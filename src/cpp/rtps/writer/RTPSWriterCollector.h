@@ -24,6 +24,7 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 
 namespace eprosima {
@@ -74,6 +75,8 @@ class RTPSWriterCollector
 
         typedef std::set<Item, ItemCmp> ItemSet;
 
+        RTPSWriterCollector() : priority_(0) {}
+
         void add_change(CacheChange_t* change, const T& remoteReader, const FragmentNumberSet_t optionalFragmentsNotSent)
         {
             if(change->getFragmentSize() > 0)
@@ -92,6 +95,20 @@ class RTPSWriterCollector
             }
         }
 
+        /**
+         * Adds a change to be sent whole, even if it is fragmented, as done for readers living in this process.
+         * Its item has fragment number zero, so it is not merged with the items of the fragments.
+         */
+        void add_whole_change(CacheChange_t* change, const T& remoteReader)
+        {
+            auto it = mItems_.emplace(change->sequenceNumber, 0, change);
+            if(std::find(it.first->remoteReaders.begin(), it.first->remoteReaders.end(), remoteReader) ==
+                    it.first->remoteReaders.end())
+            {
+                it.first->remoteReaders.push_back(remoteReader);
+            }
+        }
+
         bool empty()
         {
             return mItems_.empty();
@@ -120,9 +137,22 @@ class RTPSWriterCollector
             return mItems_;
         }
 
+        //! Priority of the writer the changes belong to, for flow controllers shared among writers.
+        int32_t priority() const
+        {
+            return priority_;
+        }
+
+        void priority(int32_t priority)
+        {
+            priority_ = priority;
+        }
+
     private:
 
         ItemSet mItems_;
+
+        int32_t priority_;
 };
 
 } // namespace rtps
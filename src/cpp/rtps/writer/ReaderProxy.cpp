@@ -41,8 +41,12 @@ ReaderProxy::ReaderProxy(
     : is_active_(false)
     , reader_attributes_()
     , writer_(writer)
+    , local_reader_(nullptr)
+    , local_heartbeat_pending_(false)
+    , local_liveliness_pending_(false)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0))
+    , released_changes_(0)
     , nack_supression_event_(nullptr)
     , timers_enabled_(false)
     , last_acknack_count_(0)
@@ -58,10 +62,13 @@ ReaderProxy::~ReaderProxy()
 {
 }
 
-void ReaderProxy::start(const RemoteReaderAttributes& reader_attributes)
+void ReaderProxy::start(
+        const RemoteReaderAttributes& reader_attributes,
+        const std::shared_ptr<LocalReaderPointer>& local_reader)
 {
     is_active_ = true;
     reader_attributes_ = reader_attributes;
+    local_reader_ = local_reader;
     guid_as_vector_.push_back(reader_attributes_.guid);
 
     reader_attributes_.endpoint.remoteLocatorList.assign(reader_attributes_.endpoint.unicastLocatorList);
@@ -77,9 +84,14 @@ void ReaderProxy::stop()
 {
     is_active_ = false;
     reader_attributes_.guid = c_Guid_Unknown;
+    local_reader_.reset();
+    local_heartbeat_pending_ = false;
+    local_liveliness_pending_ = false;
     disable_timers();
 
     changes_for_reader_.clear();
+    released_changes_ = 0;
+    changes_by_status_.fill(0);
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
@@ -113,7 +125,7 @@ void ReaderProxy::add_change(
     }
 
     // For best effort readers, changes are acked when being sent
-    if (changes_for_reader_.empty() && change.getStatus() == ACKNOWLEDGED)
+    if (!has_changes() && change.getStatus() == ACKNOWLEDGED)
     {
         changes_low_mark_ = change.getSequenceNumber();
         return;
@@ -125,23 +137,54 @@ void ReaderProxy::add_change(
         return;
     }
 
+    // Make room for the new change with the space of the released ones.
+    compact_changes(changes_for_reader_.size() == changes_for_reader_.max_size());
+
     if (changes_for_reader_.push_back(change) == nullptr)
     {
         // This should never happen
         assert(false);
         logError(RTPS_WRITER, "Error adding change " << change.getSequenceNumber() << " to reader proxy " << \
             reader_attributes_.guid);
+        return;
     }
+
+    ++changes_by_status_[change.getStatus()];
 }
 
 bool ReaderProxy::has_changes() const
 {
-    return !changes_for_reader_.empty();
+    return released_changes_ < changes_for_reader_.size();
+}
+
+void ReaderProxy::release_changes(ChangeIterator last)
+{
+    for (ChangeIterator it = changes_begin(); it != last; ++it)
+    {
+        --changes_by_status_[it->getStatus()];
+        ++released_changes_;
+    }
+}
+
+void ReaderProxy::compact_changes(bool force)
+{
+    if (released_changes_ == 0)
+    {
+        return;
+    }
+
+    // Erasing shifts the remaining changes, so it is only done when at least as many changes are released,
+    // keeping the cost per acknowledged change constant.
+    if (force || released_changes_ >= changes_for_reader_.size() - released_changes_)
+    {
+        changes_for_reader_.erase(changes_for_reader_.begin(), changes_for_reader_.begin() + released_changes_);
+        released_changes_ = 0;
+    }
 }
 
 bool ReaderProxy::change_is_acked(const SequenceNumber_t& seq_num) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_ || !has_changes())
     {
         return true;
     }
@@ -165,7 +208,8 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
     if (seq_num > changes_low_mark_)
     {
         ChangeIterator chit = find_change(seq_num, false);
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        release_changes(chit);
+        compact_changes(false);
     }
     else
     {
@@ -180,6 +224,9 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
         }
         future_low_mark = current_sequence;
 
+        // Changes will be pushed back and sorted, so released ones should be out of the way.
+        compact_changes(true);
+
         bool should_sort = false;
         for (; current_sequence <= changes_low_mark_; ++current_sequence)
         {
@@ -201,7 +248,10 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
                     should_sort = true;
                     ChangeForReader_t cr(change);
                     cr.setStatus(UNACKNOWLEDGED);
-                    changes_for_reader_.push_back(cr);
+                    if (changes_for_reader_.push_back(cr) != nullptr)
+                    {
+                        ++changes_by_status_[UNACKNOWLEDGED];
+                    }
                 }
             }
         }
@@ -220,12 +270,19 @@ bool ReaderProxy::requested_changes_set(const SequenceNumberSet_t& seq_num_set)
 {
     bool isSomeoneWasSetRequested = false;
 
+    // Both the bitmap and the collection are sorted, so they are traversed together after a single search.
+    ChangeIterator chit = find_change(seq_num_set.base(), false);
+    ChangeIterator end = changes_for_reader_.end();
     seq_num_set.for_each([&](SequenceNumber_t sit)
     {
-        ChangeIterator chit = find_change(sit, true);
-        if (chit != changes_for_reader_.end() && UNACKNOWLEDGED == chit->getStatus())
+        while (chit != end && chit->getSequenceNumber() < sit)
+        {
+            ++chit;
+        }
+
+        if (chit != end && chit->getSequenceNumber() == sit && UNACKNOWLEDGED == chit->getStatus())
         {
-            chit->setStatus(REQUESTED);
+            set_change_status(*chit, REQUESTED);
             chit->markAllFragmentsAsUnsent();
             isSomeoneWasSetRequested = true;
         }
@@ -278,16 +335,16 @@ bool ReaderProxy::set_change_to_status(
     {
         if (status == ACKNOWLEDGED && changes_low_mark_ == seq_num)
         {
-            // Erase the first change when it is acknowledged
-            assert(it == changes_for_reader_.begin());
-            changes_for_reader_.erase(it);
+            // Release the first change when it is acknowledged
+            assert(it == changes_begin());
+            release_changes(it + 1);
         }
         else
         {
             // Otherwise change status
             if (it->getStatus() != status)
             {
-                it->setStatus(status);
+                set_change_status(*it, status);
                 change_was_modified = true;
             }
         }
@@ -340,43 +397,55 @@ bool ReaderProxy::convert_status_on_all_changes(
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
-    bool at_least_one_modified = false;
-    for(ChangeForReader_t& change : changes_for_reader_)
+    size_t pending = changes_by_status_[previous];
+    if (pending == 0)
     {
-        if (change.getStatus() == previous)
+        return false;
+    }
+
+    for (ChangeIterator it = changes_begin(); pending > 0 && it != changes_for_reader_.end(); ++it)
+    {
+        if (it->getStatus() == previous)
         {
-            at_least_one_modified = true;
-            change.setStatus(next);
+            set_change_status(*it, next);
+            --pending;
         }
     }
 
-    return at_least_one_modified;
+    return true;
 }
 
 void ReaderProxy::change_has_been_removed(const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (!has_changes() || seq_num < changes_begin()->getSequenceNumber())
     {
         return;
     }
 
     // Element may not be in the container when marked as irrelevant.
-    auto chit = find_change(seq_num);
-    changes_for_reader_.erase(chit);
-}
+    ChangeIterator chit = find_change(seq_num, true);
+    if (chit == changes_for_reader_.end())
+    {
+        return;
+    }
 
-bool ReaderProxy::has_unacknowledged() const
-{
-    for (const ChangeForReader_t& it : changes_for_reader_)
+    if (chit == changes_begin())
     {
-        if (it.isRelevant() && it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
+        // Removing the oldest change is the usual case, and it does not need to shift the collection.
+        release_changes(chit + 1);
+    }
+    else
+    {
+        --changes_by_status_[chit->getStatus()];
+        changes_for_reader_.erase(chit);
     }
+}
 
-    return false;
+bool ReaderProxy::has_unacknowledged() const
+{
+    // Irrelevant changes are never added to the collection.
+    return changes_by_status_[UNACKNOWLEDGED] > 0;
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -395,7 +464,7 @@ bool ReaderProxy::requested_fragment_set(
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
     if (changeIter->getStatus() != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        set_change_status(*changeIter, REQUESTED);
     }
 
     return true;
@@ -435,7 +504,7 @@ ReaderProxy::ChangeIterator ReaderProxy::find_change(
 {
     ReaderProxy::ChangeIterator it;
     ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    it = std::lower_bound(changes_begin(), end, seq_num, change_less_than_sequence);
 
     return (!exact)
         ? it
@@ -448,7 +517,7 @@ ReaderProxy::ChangeConstIterator ReaderProxy::find_change(const SequenceNumber_t
 {
     ReaderProxy::ChangeConstIterator it;
     ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    it = std::lower_bound(changes_begin(), end, seq_num, change_less_than_sequence);
 
     return it == end
         ? it
@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
 
 #include "../participant/RTPSParticipantImpl.h"
+#include "HeartbeatScheduler.h"
 #include "../flowcontrol/FlowController.h"
 
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
@@ -36,6 +37,7 @@
 #include <fastrtps/rtps/writer/timedevent/NackResponseDelay.h>
 
 #include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
 
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
@@ -45,6 +47,7 @@
 
 #include "RTPSWriterCollector.h"
 #include "StatefulWriterOrganizer.h"
+#include "../reader/LocalReaderPointer.h"
 
 #include <mutex>
 #include <vector>
@@ -62,6 +65,7 @@ StatefulWriter::StatefulWriter(
         WriterListener* listen)
     : RTPSWriter(pimpl, guid, att, hist, listen)
     , mp_periodicHB(nullptr)
+    , heartbeat_scheduler_(pimpl->heartbeat_scheduler())
     , m_heartbeatCount(0)
     , m_times(att.times)
     , matched_readers_(att.matched_readers_allocation)
@@ -82,7 +86,14 @@ StatefulWriter::StatefulWriter(
 {
     m_heartbeatCount = 0;
 
-    mp_periodicHB = new PeriodicHeartbeat(this,TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    if (heartbeat_scheduler_ != nullptr)
+    {
+        heartbeat_scheduler_->register_writer(this);
+    }
+    else
+    {
+        mp_periodicHB = new PeriodicHeartbeat(this,TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    }
     nack_response_event_ = new NackResponseDelay(this, TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
 
     if (disable_positive_acks_)
@@ -105,6 +116,11 @@ StatefulWriter::~StatefulWriter()
 {
     AsyncWriterThread::removeWriter(*this);
 
+    if (heartbeat_scheduler_ != nullptr)
+    {
+        heartbeat_scheduler_->unregister_writer(this);
+    }
+
     logInfo(RTPS_WRITER,"StatefulWriter destructor");
 
     if (disable_positive_acks_)
@@ -166,11 +182,18 @@ void StatefulWriter::unsent_change_added_to_history(
             // First step is to add the new CacheChange_t to all reader proxies.
             // It has to be done before sending, because if a timeout is catched, we will not include the
             // CacheChange_t in some reader proxies.
+            bool has_local_readers = false;
             for (ReaderProxy* it : matched_readers_)
             {
                 ChangeForReader_t changeForReader(change);
 
-                if(m_pushMode)
+                if (it->is_local_reader())
+                {
+                    // Readers living in this process are served by the async thread, out of the writer mutex
+                    changeForReader.setStatus(UNSENT);
+                    has_local_readers = true;
+                }
+                else if(m_pushMode)
                 {
                     if(it->is_reliable())
                     {
@@ -191,31 +214,44 @@ void StatefulWriter::unsent_change_added_to_history(
                 expectsInlineQos |= it->expects_inline_qos();
             }
 
+            if (has_local_readers)
+            {
+                AsyncWriterThread::wakeUp(this);
+            }
+
             try
             {
                 //At this point we are sure all information was stores. We now can send data.
                 if (!m_separateSendingEnabled)
                 {
-                    RTPSMessageGroup group(
-                                mp_RTPSParticipant,
-                                this,
-                                RTPSMessageGroup::WRITER,
-                                m_cdrmessages,
-                                max_blocking_time);
-
-                    if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList, expectsInlineQos))
+                    if (!all_remote_readers_.empty())
                     {
-                        logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
-                    }
+                        RTPSMessageGroup group(
+                                    mp_RTPSParticipant,
+                                    this,
+                                    RTPSMessageGroup::WRITER,
+                                    m_cdrmessages,
+                                    max_blocking_time);
+
+                        if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList, expectsInlineQos))
+                        {
+                            logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                        }
 
-                    // Heartbeat piggyback.
-                    uint32_t last_processed = 0;
-                    send_heartbeat_piggyback_nts_(group, last_processed);
+                        // Heartbeat piggyback.
+                        uint32_t last_processed = 0;
+                        send_heartbeat_piggyback_nts_(group, last_processed);
+                    }
                 }
                 else
                 {
                     for (ReaderProxy* it : matched_readers_)
                     {
+                        if (it->is_local_reader())
+                        {
+                            continue;
+                        }
+
                         const std::vector<GUID_t>& guids = it->guid_as_vector();
                         const LocatorList_t& locators = it->remote_locators_shrinked();
                         RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
@@ -229,8 +265,10 @@ void StatefulWriter::unsent_change_added_to_history(
                     }
                 }
 
-                this->mp_periodicHB->restart_timer();
-                if ( (mp_listener != nullptr) && this->is_acked_by_all(change) )
+                restart_periodic_heartbeat();
+                // Changes acknowledged by local readers may have been notified already by check_acked_status()
+                if ( (mp_listener != nullptr) && next_all_acked_notify_sequence_ <= change->sequenceNumber &&
+                        this->is_acked_by_all(change) )
                 {
                     mp_listener->onWriterChangeReceivedByAll(this, change);
                 }
@@ -247,11 +285,12 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
+            bool has_local_readers = false;
             for(ReaderProxy* it : matched_readers_)
             {
                 ChangeForReader_t changeForReader(change);
 
-                if(m_pushMode)
+                if(m_pushMode || it->is_local_reader())
                 {
                     changeForReader.setStatus(UNSENT);
                 }
@@ -262,9 +301,10 @@ void StatefulWriter::unsent_change_added_to_history(
 
                 changeForReader.setRelevance(it->rtps_is_relevant(change));
                 it->add_change(changeForReader, false);
+                has_local_readers |= it->is_local_reader();
             }
 
-            if (m_pushMode)
+            if (m_pushMode || has_local_readers)
             {
                 AsyncWriterThread::wakeUp(this);
             }
@@ -321,11 +361,14 @@ bool StatefulWriter::change_removed_by_history(CacheChange_t* a_change)
 
 void StatefulWriter::send_any_unsent_changes()
 {
-    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    std::unique_lock<std::recursive_timed_mutex> lock(mp_mutex);
 
     bool activateHeartbeatPeriod = false;
     SequenceNumber_t max_sequence = mp_history->next_sequence_number();
 
+    // Readers living in this process are served once the mutex is released
+    std::vector<LocalDelivery> local_deliveries;
+
     // Separate sending for asynchronous writers
     if (m_pushMode && m_separateSendingEnabled)
     {
@@ -333,6 +376,12 @@ void StatefulWriter::send_any_unsent_changes()
         {
             for (ReaderProxy* remoteReader : matched_readers_)
             {
+                if (remoteReader->is_local_reader())
+                {
+                    collect_unsent_changes_nts(*remoteReader, local_deliveries, nullptr);
+                    continue;
+                }
+
                 try
                 {
                     // For possible GAP
@@ -405,10 +454,19 @@ void StatefulWriter::send_any_unsent_changes()
     else
     {
         RTPSWriterCollector<ReaderProxy*> relevantChanges;
+        relevantChanges.priority(flow_controller_priority_);
         StatefulWriterOrganizer notRelevantChanges;
 
         for (ReaderProxy* remoteReader : matched_readers_)
         {
+            if (remoteReader->is_local_reader())
+            {
+                // Asynchronous writers send to local readers through the flow controllers, like to remote ones
+                collect_unsent_changes_nts(*remoteReader, local_deliveries,
+                        (isAsync() && m_pushMode) ? &relevantChanges : nullptr);
+                continue;
+            }
+
             auto unsent_change_process = [&](const SequenceNumber_t& seq_num, const ChangeForReader_t* unsentChange)
             {
                 if (unsentChange != nullptr && unsentChange->isRelevant() && unsentChange->isValid())
@@ -457,18 +515,46 @@ void StatefulWriter::send_any_unsent_changes()
                     std::vector<GUID_t> remote_readers;
                     std::vector<LocatorList_t> locatorLists;
                     bool expectsInlineQos = false;
+                    std::shared_ptr<CacheChange_t> local_copy;
 
-                    for (const ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                    for (auto it = changeToSend.remoteReaders.begin(); it != changeToSend.remoteReaders.end();)
                     {
+                        ReaderProxy* remoteReader = *it;
+                        if (remoteReader->is_local_reader())
+                        {
+                            // Local readers always get whole changes, from a single copy
+                            if (!local_copy)
+                            {
+                                local_copy = copy_for_local_delivery(changeToSend.cacheChange);
+                            }
+                            if (local_copy)
+                            {
+                                local_delivery_nts(local_deliveries, *remoteReader).changes.push_back(local_copy);
+                            }
+                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                            if (remoteReader->is_reliable())
+                            {
+                                activateHeartbeatPeriod = true;
+                            }
+                            it = changeToSend.remoteReaders.erase(it);
+                            continue;
+                        }
+
                         remote_readers.push_back(remoteReader->guid());
                         locatorLists.push_back(remoteReader->remote_locators());
                         expectsInlineQos |= remoteReader->expects_inline_qos();
+                        ++it;
                     }
 
                     // TODO(Ricardo) Flowcontroller has to be used in RTPSMessageGroup. Study.
                     // And controllers are notified about the changes being sent
                     FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
 
+                    if (remote_readers.empty())
+                    {
+                        continue;
+                    }
+
                     if (changeToSend.fragmentNumber != 0)
                     {
                         if (group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, remote_readers,
@@ -560,7 +646,7 @@ void StatefulWriter::send_any_unsent_changes()
                 logError(RTPS_WRITER, "Max blocking time reached");
             }
         }
-        else
+        else if (!all_remote_readers_.empty())
         {
             try
             {
@@ -581,9 +667,34 @@ void StatefulWriter::send_any_unsent_changes()
         }
     }
 
+    for (ReaderProxy* remoteReader : matched_readers_)
+    {
+        bool liveliness = false;
+        if (remoteReader->is_local_reader() && remoteReader->take_local_heartbeat(liveliness))
+        {
+            collect_heartbeat_nts(local_delivery_nts(local_deliveries, *remoteReader), liveliness);
+        }
+    }
+
     if (activateHeartbeatPeriod)
     {
-        this->mp_periodicHB->restart_timer();
+        restart_periodic_heartbeat();
+    }
+
+    if (!local_deliveries.empty())
+    {
+        // Readers may notify their listeners, which may write on this writer
+        lock.unlock();
+        for (LocalDelivery& delivery : local_deliveries)
+        {
+            deliver_locally(delivery);
+        }
+        lock.lock();
+
+        for (const LocalDelivery& delivery : local_deliveries)
+        {
+            apply_local_acknack_nts(delivery);
+        }
     }
 
     // On VOLATILE writers, remove auto-acked (best effort readers) changes
@@ -617,7 +728,10 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
             return false;
         }
 
-        allLocatorLists.push_back(it->remote_locators());
+        if (!it->is_local_reader())
+        {
+            allLocatorLists.push_back(it->remote_locators());
+        }
     }
 
     // Get a reader proxy from the inactive pool (or create a new one if necessary and allowed)
@@ -642,20 +756,26 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
         matched_readers_pool_.pop_back();
     }
 
+    // Readers living in this process are not reached through the transports
+    std::shared_ptr<LocalReaderPointer> local_reader = find_local_reader(rdata.guid);
+
     // Add info of new datareader.
-    all_remote_readers_.push_back(rdata.guid);
-    LocatorList_t locators(rdata.endpoint.unicastLocatorList);
-    locators.push_back(rdata.endpoint.multicastLocatorList);
-    allLocatorLists.push_back(locators);
+    if (!local_reader)
+    {
+        all_remote_readers_.push_back(rdata.guid);
+        LocatorList_t locators(rdata.endpoint.unicastLocatorList);
+        locators.push_back(rdata.endpoint.multicastLocatorList);
+        allLocatorLists.push_back(locators);
 
-    update_cached_info_nts(allLocatorLists);
+        update_cached_info_nts(allLocatorLists);
 
-    getRTPSParticipant()->createSenderResources(mAllShrinkedLocatorList, false);
+        getRTPSParticipant()->createSenderResources(mAllShrinkedLocatorList, false);
+    }
 
     rdata.endpoint.unicastLocatorList =
         mp_RTPSParticipant->network_factory().ShrinkLocatorLists({rdata.endpoint.unicastLocatorList});
 
-    rp->start(rdata);
+    rp->start(rdata, local_reader);
     std::set<SequenceNumber_t> not_relevant_changes;
 
     SequenceNumber_t current_seq = get_seq_num_min();
@@ -693,8 +813,8 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
                 not_relevant_changes.insert(changeForReader.getSequenceNumber());
             }
 
-            // The ChangeForReader_t status has to be UNACKNOWLEDGED
-            changeForReader.setStatus(UNACKNOWLEDGED);
+            // The ChangeForReader_t status has to be UNACKNOWLEDGED, unless it is delivered by the async thread
+            changeForReader.setStatus(rp->is_local_reader() ? UNSENT : UNACKNOWLEDGED);
             rp->add_change(changeForReader, false);
             ++current_seq;
         }
@@ -706,39 +826,47 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
             ++current_seq;
         }
 
-        try
+        if (rp->is_local_reader())
         {
-            const std::vector<GUID_t>& guids = rp->guid_as_vector();
-            const LocatorList_t& locatorsList = rp->remote_locators_shrinked();
-            RTPSMessageGroup group(
-                        mp_RTPSParticipant,
-                        this,
-                        RTPSMessageGroup::WRITER,
-                        m_cdrmessages,
-                        locatorsList,
-                        guids);
-
-            // Send initial heartbeat
-            send_heartbeat_nts_(
-                        guids,
-                        locatorsList,
-                        group,
-                        disable_positive_acks_);
+            // Initial heartbeat, followed by the durable changes and the gaps for the rest, from the async thread
+            schedule_local_heartbeat_nts(*rp);
+        }
+        else
+        {
+            try
+            {
+                const std::vector<GUID_t>& guids = rp->guid_as_vector();
+                const LocatorList_t& locatorsList = rp->remote_locators_shrinked();
+                RTPSMessageGroup group(
+                            mp_RTPSParticipant,
+                            this,
+                            RTPSMessageGroup::WRITER,
+                            m_cdrmessages,
+                            locatorsList,
+                            guids);
 
-            // Send Gap
-            if(!not_relevant_changes.empty())
+                // Send initial heartbeat
+                send_heartbeat_nts_(
+                            guids,
+                            locatorsList,
+                            group,
+                            disable_positive_acks_);
+
+                // Send Gap
+                if(!not_relevant_changes.empty())
+                {
+                    group.add_gap(not_relevant_changes, guids, locatorsList);
+                }
+            }
+            catch(const RTPSMessageGroup::timeout&)
             {
-                group.add_gap(not_relevant_changes, guids, locatorsList);
+                logError(RTPS_WRITER, "Max blocking time reached");
             }
         }
-        catch(const RTPSMessageGroup::timeout&)
-        {
-            logError(RTPS_WRITER, "Max blocking time reached");
-        }
 
         // Always activate heartbeat period. We need a confirmation of the reader.
         // The state has to be updated.
-        this->mp_periodicHB->restart_timer();
+        restart_periodic_heartbeat();
     }
     else
     {
@@ -773,7 +901,10 @@ bool StatefulWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
             continue;
         }
 
-        allLocatorLists.push_back((*it)->remote_locators());
+        if (!(*it)->is_local_reader())
+        {
+            allLocatorLists.push_back((*it)->remote_locators());
+        }
         ++it;
     }
 
@@ -781,7 +912,7 @@ bool StatefulWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
     update_cached_info_nts(allLocatorLists);
 
     if(matched_readers_.size()==0)
-        this->mp_periodicHB->cancel_timer();
+        cancel_periodic_heartbeat();
 
     lock.unlock();
 
@@ -979,7 +1110,8 @@ void StatefulWriter::updateAttributes(const WriterAttributes& att)
 void StatefulWriter::updateTimes(const WriterTimes& times)
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
-    if(m_times.heartbeatPeriod != times.heartbeatPeriod)
+    // The heartbeat scheduler takes the new period from m_times on the next restart.
+    if(m_times.heartbeatPeriod != times.heartbeatPeriod && mp_periodicHB != nullptr)
     {
         this->mp_periodicHB->update_interval(times.heartbeatPeriod);
     }
@@ -1055,25 +1187,36 @@ bool StatefulWriter::send_periodic_heartbeat(
 
             if (unacked_changes)
             {
-                try
+                for (ReaderProxy* it : matched_readers_)
                 {
-                    RTPSMessageGroup group(
-                                mp_RTPSParticipant,
-                                this,
-                                RTPSMessageGroup::WRITER,
-                                m_cdrmessages,
-                                mAllShrinkedLocatorList,
-                                all_remote_readers_);
-                    send_heartbeat_nts_(
-                                all_remote_readers_,
-                                mAllShrinkedLocatorList,
-                                group,
-                                disable_positive_acks_,
-                                liveliness);
+                    if (it->is_local_reader() && it->has_unacknowledged())
+                    {
+                        schedule_local_heartbeat_nts(*it);
+                    }
                 }
-                catch(const RTPSMessageGroup::timeout&)
+
+                if (!all_remote_readers_.empty())
                 {
-                    logError(RTPS_WRITER, "Max blocking time reached");
+                    try
+                    {
+                        RTPSMessageGroup group(
+                                    mp_RTPSParticipant,
+                                    this,
+                                    RTPSMessageGroup::WRITER,
+                                    m_cdrmessages,
+                                    mAllShrinkedLocatorList,
+                                    all_remote_readers_);
+                        send_heartbeat_nts_(
+                                    all_remote_readers_,
+                                    mAllShrinkedLocatorList,
+                                    group,
+                                    disable_positive_acks_,
+                                    liveliness);
+                    }
+                    catch(const RTPSMessageGroup::timeout&)
+                    {
+                        logError(RTPS_WRITER, "Max blocking time reached");
+                    }
                 }
             }
         }
@@ -1081,35 +1224,149 @@ bool StatefulWriter::send_periodic_heartbeat(
     else
     {
         // This is a liveliness heartbeat, we don't care about checking sequence numbers
-        try
+        for (ReaderProxy* it : matched_readers_)
         {
-            RTPSMessageGroup group(
-                        mp_RTPSParticipant,
-                        this,
-                        RTPSMessageGroup::WRITER,
-                        m_cdrmessages,
-                        mAllShrinkedLocatorList,
-                        all_remote_readers_);
-            send_heartbeat_nts_(
-                        all_remote_readers_,
-                        mAllShrinkedLocatorList,
-                        group,
-                        final,
-                        liveliness);
+            if (it->is_local_reader())
+            {
+                schedule_local_heartbeat_nts(*it, true);
+            }
+        }
+
+        if (!all_remote_readers_.empty())
+        {
+            try
+            {
+                RTPSMessageGroup group(
+                            mp_RTPSParticipant,
+                            this,
+                            RTPSMessageGroup::WRITER,
+                            m_cdrmessages,
+                            mAllShrinkedLocatorList,
+                            all_remote_readers_);
+                send_heartbeat_nts_(
+                            all_remote_readers_,
+                            mAllShrinkedLocatorList,
+                            group,
+                            final,
+                            liveliness);
+            }
+            catch(const RTPSMessageGroup::timeout&)
+            {
+                logError(RTPS_WRITER, "Max blocking time reached");
+            }
+        }
+    }
+
+    return unacked_changes;
+}
+
+bool StatefulWriter::send_coalesced_heartbeat(HeartbeatScheduler& scheduler)
+{
+    std::lock_guard<std::recursive_timed_mutex> guardW(mp_mutex);
+
+    bool unacked_changes = false;
+    try
+    {
+        if (m_separateSendingEnabled)
+        {
+            for (ReaderProxy* it : matched_readers_)
+            {
+                if (it->has_unacknowledged())
+                {
+                    unacked_changes = true;
+
+                    if (it->is_local_reader())
+                    {
+                        schedule_local_heartbeat_nts(*it);
+                    }
+                    else
+                    {
+                        const LocatorList_t& locators = it->remote_locators_shrinked();
+                        send_heartbeat_nts_(
+                                    it->guid_as_vector(),
+                                    locators,
+                                    scheduler.message_group(this, locators),
+                                    disable_positive_acks_);
+                    }
+                }
+            }
         }
-        catch(const RTPSMessageGroup::timeout&)
+        else
         {
-            logError(RTPS_WRITER, "Max blocking time reached");
+            if (get_seq_num_min() == c_SequenceNumber_Unknown || get_seq_num_max() == c_SequenceNumber_Unknown)
+            {
+                return false;
+            }
+
+            unacked_changes = std::any_of(matched_readers_.begin(), matched_readers_.end(),
+                [](const ReaderProxy* reader)
+                {
+                    return reader->has_unacknowledged();
+                });
+
+            if (unacked_changes)
+            {
+                for (ReaderProxy* it : matched_readers_)
+                {
+                    if (it->is_local_reader() && it->has_unacknowledged())
+                    {
+                        schedule_local_heartbeat_nts(*it);
+                    }
+                }
+
+                if (!all_remote_readers_.empty())
+                {
+                    send_heartbeat_nts_(
+                                all_remote_readers_,
+                                mAllShrinkedLocatorList,
+                                scheduler.message_group(this, mAllShrinkedLocatorList),
+                                disable_positive_acks_);
+                }
+            }
         }
     }
+    catch(const RTPSMessageGroup::timeout&)
+    {
+        logError(RTPS_WRITER, "Max blocking time reached");
+    }
 
     return unacked_changes;
 }
 
+void StatefulWriter::restart_periodic_heartbeat()
+{
+    if (heartbeat_scheduler_ != nullptr)
+    {
+        heartbeat_scheduler_->activate(this, m_times.heartbeatPeriod);
+    }
+    else
+    {
+        mp_periodicHB->restart_timer();
+    }
+}
+
+void StatefulWriter::cancel_periodic_heartbeat()
+{
+    if (heartbeat_scheduler_ != nullptr)
+    {
+        heartbeat_scheduler_->deactivate(this);
+    }
+    else
+    {
+        mp_periodicHB->cancel_timer();
+    }
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness)
 {
+    if (remoteReaderProxy.is_local_reader())
+    {
+        schedule_local_heartbeat_nts(remoteReaderProxy, liveliness);
+        return;
+    }
+
     try
     {
         const std::vector<GUID_t>& guids = remoteReaderProxy.guid_as_vector();
@@ -1243,7 +1500,7 @@ void StatefulWriter::perform_nack_supression(const GUID_t& reader_guid)
         if (remote_reader->guid() == reader_guid)
         {
             remote_reader->perform_nack_supression();
-            mp_periodicHB->restart_timer();
+            restart_periodic_heartbeat();
             return;
         }
     }
@@ -1277,7 +1534,7 @@ bool StatefulWriter::process_acknack(
                         }
                         else if (!final_flag)
                         {
-                            mp_periodicHB->restart_timer();
+                            restart_periodic_heartbeat();
                         }
                     }
                     else if (sn_set.empty() && !final_flag)
@@ -1372,3 +1629,153 @@ void StatefulWriter::ack_timer_expired()
     ack_timer_->update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
     ack_timer_->restart_timer();
 }
+
+StatefulWriter::LocalDelivery& StatefulWriter::local_delivery_nts(
+        std::vector<LocalDelivery>& deliveries,
+        const ReaderProxy& reader_proxy)
+{
+    for (LocalDelivery& delivery : deliveries)
+    {
+        if (delivery.reader == reader_proxy.local_reader())
+        {
+            return delivery;
+        }
+    }
+
+    deliveries.emplace_back(reader_proxy.local_reader(), reader_proxy.is_reliable());
+    return deliveries.back();
+}
+
+void StatefulWriter::collect_unsent_changes_nts(
+        ReaderProxy& reader_proxy,
+        std::vector<LocalDelivery>& deliveries,
+        RTPSWriterCollector<ReaderProxy*>* collector)
+{
+    bool is_reliable = reader_proxy.is_reliable();
+
+    auto unsent_change_process = [&](const SequenceNumber_t& seq_num, const ChangeForReader_t* unsent_change)
+    {
+        if (unsent_change != nullptr && unsent_change->isRelevant() && unsent_change->isValid())
+        {
+            if (collector != nullptr)
+            {
+                // Marked as sent when it goes out of the collector
+                collector->add_whole_change(unsent_change->getChange(), &reader_proxy);
+                return;
+            }
+
+            std::shared_ptr<CacheChange_t> copy = copy_for_local_delivery(unsent_change->getChange());
+            if (copy)
+            {
+                local_delivery_nts(deliveries, reader_proxy).changes.push_back(copy);
+            }
+        }
+        else if (is_reliable)
+        {
+            local_delivery_nts(deliveries, reader_proxy).irrelevant.emplace(seq_num);
+        }
+        reader_proxy.set_change_to_status(seq_num, UNDERWAY, true);
+    };
+    reader_proxy.for_each_unsent_change(mp_history->next_sequence_number(), unsent_change_process);
+}
+
+void StatefulWriter::collect_heartbeat_nts(
+        LocalDelivery& delivery,
+        bool liveliness)
+{
+    SequenceNumber_t first_seq = get_seq_num_min();
+    SequenceNumber_t last_seq = get_seq_num_max();
+
+    if (first_seq == c_SequenceNumber_Unknown || last_seq == c_SequenceNumber_Unknown)
+    {
+        first_seq = next_sequence_number();
+        last_seq = first_seq - 1;
+    }
+
+    incrementHBCount();
+    delivery.heartbeat = true;
+    delivery.liveliness = liveliness;
+    delivery.heartbeat_count = m_heartbeatCount;
+    delivery.first_seq = first_seq;
+    delivery.last_seq = last_seq;
+}
+
+void StatefulWriter::schedule_local_heartbeat_nts(
+        ReaderProxy& reader_proxy,
+        bool liveliness)
+{
+    reader_proxy.request_local_heartbeat(liveliness);
+    AsyncWriterThread::wakeUp(this);
+}
+
+void StatefulWriter::deliver_locally(LocalDelivery& delivery)
+{
+    GUID_t writer_guid = m_guid;
+
+    // The heartbeat goes first, so a reader matched right now knows which changes it can expect
+    if (delivery.heartbeat)
+    {
+        // The final flag is always set, so the reader only answers when it misses some change
+        delivery.reader->with_reader([&](RTPSReader& reader)
+        {
+            return reader.processHeartbeatMsg(writer_guid, delivery.heartbeat_count, delivery.first_seq,
+                    delivery.last_seq, true, delivery.liveliness);
+        });
+    }
+
+    for (const std::shared_ptr<CacheChange_t>& change : delivery.changes)
+    {
+        intraprocess_delivery(change.get(), *delivery.reader);
+    }
+
+    if (!delivery.irrelevant.empty())
+    {
+        delivery.reader->with_reader([&](RTPSReader& reader)
+        {
+            // Each run of consecutive sequence numbers is informed as a range, without bitmap
+            std::set<SequenceNumber_t>::const_iterator it = delivery.irrelevant.begin();
+            while (it != delivery.irrelevant.end())
+            {
+                SequenceNumber_t gap_start = *it;
+                SequenceNumber_t gap_end = gap_start;
+                while (++it != delivery.irrelevant.end() && *it == gap_end + 1)
+                {
+                    ++gap_end;
+                }
+
+                SequenceNumberSet_t gap_list(gap_end + 1);
+                reader.processGapMsg(writer_guid, gap_start, gap_list);
+            }
+            return true;
+        });
+    }
+
+    if (delivery.reliable)
+    {
+        delivery.acknowledged = delivery.reader->with_reader([&](RTPSReader& reader)
+        {
+            return reader.get_acknack_base(writer_guid, delivery.ack_base);
+        });
+    }
+}
+
+void StatefulWriter::apply_local_acknack_nts(const LocalDelivery& delivery)
+{
+    if (!delivery.acknowledged)
+    {
+        return;
+    }
+
+    // The reader may have been unmatched while the mutex was released, and its proxy reused for another reader
+    for (ReaderProxy* reader_proxy : matched_readers_)
+    {
+        if (reader_proxy->local_reader() == delivery.reader)
+        {
+            if (delivery.ack_base > reader_proxy->changes_low_mark())
+            {
+                reader_proxy->acked_changes_set(delivery.ack_base);
+            }
+            break;
+        }
+    }
+}
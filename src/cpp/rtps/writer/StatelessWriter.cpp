@@ -25,6 +25,7 @@
 #include "../flowcontrol/FlowController.h"
 #include "../history/HistoryAttributesExtension.hpp"
 #include "RTPSWriterCollector.h"
+#include "../reader/LocalReaderPointer.h"
 #include <fastrtps/rtps/builtin/BuiltinProtocols.h>
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
 
@@ -52,6 +53,7 @@ StatelessWriter::StatelessWriter(
           history,
           listener)
     , matched_readers_(attributes.matched_readers_allocation)
+    , matched_local_readers_(attributes.matched_readers_allocation)
     , unsent_changes_(resource_limits_from_history(history->m_att))
 {
     get_builtin_guid(all_remote_readers_);
@@ -104,63 +106,79 @@ void StatelessWriter::unsent_change_added_to_history(
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
 
-    if (!mAllShrinkedLocatorList.empty())
+    if (!mAllShrinkedLocatorList.empty() || !matched_local_readers_.empty())
     {
 #if HAVE_SECURITY
         encrypt_cachechange(change);
 #endif
 
-        if (!isAsync())
+        // Readers living in this process are served by the async thread, out of the writer mutex.
+        // The listener is notified once they have been delivered the change.
+        for (const std::shared_ptr<LocalReaderPointer>& local_reader : matched_local_readers_)
         {
-            try
+            unsent_local_changes_.push_back({local_reader, change});
+        }
+
+        if (!matched_local_readers_.empty())
+        {
+            AsyncWriterThread::wakeUp(this);
+        }
+
+        if (!mAllShrinkedLocatorList.empty())
+        {
+            if (!isAsync())
             {
-                if(m_separateSendingEnabled)
+                try
                 {
-                    std::vector<GUID_t> guids(1);
-                    for (const RemoteReaderAttributes& it : matched_readers_)
+                    if(m_separateSendingEnabled)
                     {
-                        guids.at(0) = it.guid;
-                        RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
-                                it.endpoint.unicastLocatorList, guids, max_blocking_time);
-
-                        if (!group.add_data(*change, guids, it.endpoint.unicastLocatorList, it.expectsInlineQos))
+                        std::vector<GUID_t> guids(1);
+                        for (const RemoteReaderAttributes& it : matched_readers_)
+                        {
+                            guids.at(0) = it.guid;
+                            RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
+                                    it.endpoint.unicastLocatorList, guids, max_blocking_time);
+
+                            if (!group.add_data(*change, guids, it.endpoint.unicastLocatorList, it.expectsInlineQos))
+                            {
+                                logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        RTPSMessageGroup group(
+                                    mp_RTPSParticipant,
+                                    this,
+                                    RTPSMessageGroup::WRITER,
+                                    m_cdrmessages,
+                                    mAllShrinkedLocatorList,
+                                    all_remote_readers_,
+                                    max_blocking_time);
+
+                        if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList,
+                                    is_inline_qos_expected_))
                         {
                             logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                         }
                     }
-                }
-                else
-                {
-                    RTPSMessageGroup group(
-                                mp_RTPSParticipant,
-                                this,
-                                RTPSMessageGroup::WRITER,
-                                m_cdrmessages,
-                                mAllShrinkedLocatorList,
-                                all_remote_readers_,
-                                max_blocking_time);
-
-                    if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList, is_inline_qos_expected_))
+
+                    if (mp_listener != nullptr && is_acked_by_all(change))
                     {
-                        logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
+                        mp_listener->onWriterChangeReceivedByAll(this, change);
                     }
                 }
-
-                if (mp_listener != nullptr)
+                catch(const RTPSMessageGroup::timeout&)
                 {
-                    mp_listener->onWriterChangeReceivedByAll(this, change);
+                    logError(RTPS_WRITER, "Max blocking time reached");
                 }
             }
-            catch(const RTPSMessageGroup::timeout&)
+            else
             {
-                logError(RTPS_WRITER, "Max blocking time reached");
+                unsent_changes_.push_back(ChangeForReader_t(change));
+                AsyncWriterThread::wakeUp(this);
             }
         }
-        else
-        {
-            unsent_changes_.push_back(ChangeForReader_t(change));
-            AsyncWriterThread::wakeUp(this);
-        }
 
         if (liveliness_lease_duration_ < c_TimeInfinite)
         {
@@ -191,16 +209,32 @@ bool StatelessWriter::change_removed_by_history(CacheChange_t* change)
             cptr.getChange()->sequenceNumber == change->sequenceNumber;
     });
 
+    unsent_local_changes_.erase(std::remove_if(unsent_local_changes_.begin(), unsent_local_changes_.end(),
+        [change](const LocalUnsentChange& local_change)
+    {
+        return local_change.change == change;
+    }), unsent_local_changes_.end());
+
     return true;
 }
 
 bool StatelessWriter::is_acked_by_all(const CacheChange_t* change) const
 {
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+
+    // Return false if change is pending to be delivered to a reader living in this process
+    if (std::any_of(unsent_local_changes_.begin(), unsent_local_changes_.end(),
+        [change](const LocalUnsentChange& local_change)
+    {
+        return change == local_change.change;
+    }))
+    {
+        return false;
+    }
+
     // Only asynchronous writers may have unacked (i.e. unsent changes)
     if (isAsync())
     {
-        std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
-
         // Return false if change is pending to be sent
         auto it = std::find_if(unsent_changes_.begin(),
             unsent_changes_.end(),
@@ -242,19 +276,72 @@ void StatelessWriter::update_unsent_changes(
     }
 }
 
+void StatelessWriter::take_unsent_local_changes_nts(
+        const CacheChange_t* change,
+        std::vector<LocalDelivery>& deliveries)
+{
+    // The readers of a change share the same copy
+    CacheChange_t* copied_change = nullptr;
+    std::shared_ptr<CacheChange_t> copy;
+
+    auto it = unsent_local_changes_.begin();
+    while (it != unsent_local_changes_.end())
+    {
+        if (change != nullptr && it->change != change)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->change != copied_change)
+        {
+            copied_change = it->change;
+            copy = copy_for_local_delivery(copied_change);
+        }
+
+        if (copy)
+        {
+            deliveries.emplace_back(it->reader, copy);
+        }
+        it = unsent_local_changes_.erase(it);
+    }
+}
+
 void StatelessWriter::send_any_unsent_changes()
 {
     //TODO(Mcc) Separate sending for asynchronous writers
-    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    std::unique_lock<std::recursive_timed_mutex> lock(mp_mutex);
 
     ReaderLocator tmp;
+    // Stands for the readers living in this process, which are delivered once the mutex is released
+    ReaderLocator local_tmp;
+    std::vector<LocalDelivery> local_deliveries;
+    std::set<SequenceNumber_t> sent_changes;
     RTPSWriterCollector<ReaderLocator*> changesToSend;
+    changesToSend.priority(flow_controller_priority_);
 
     for (const ChangeForReader_t& unsentChange : unsent_changes_)
     {
         changesToSend.add_change(unsentChange.getChange(), &tmp, unsentChange.getUnsentFragments());
     }
 
+    if (isAsync())
+    {
+        // Asynchronous writers deliver to local readers through the flow controllers, like to remote ones
+        for (const LocalUnsentChange& local_change : unsent_local_changes_)
+        {
+            changesToSend.add_whole_change(local_change.change, &local_tmp);
+        }
+    }
+    else
+    {
+        for (const LocalUnsentChange& local_change : unsent_local_changes_)
+        {
+            sent_changes.insert(local_change.change->sequenceNumber);
+        }
+        take_unsent_local_changes_nts(nullptr, local_deliveries);
+    }
+
     // Clear through local controllers
     for (auto& controller : flow_controllers_)
     {
@@ -272,18 +359,29 @@ void StatelessWriter::send_any_unsent_changes()
         RTPSMessageGroup group(mp_RTPSParticipant, this,  RTPSMessageGroup::WRITER, m_cdrmessages,
             mAllShrinkedLocatorList, all_remote_readers_);
 
-        bool bHasListener = mp_listener != nullptr;
         while(!changesToSend.empty())
         {
             RTPSWriterCollector<ReaderLocator*>::Item changeToSend = changesToSend.pop();
+            const std::vector<ReaderLocator*>& destinations = changeToSend.remoteReaders;
+            sent_changes.insert(changeToSend.sequenceNumber);
+
+            // Notify the controllers
+            FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
+
+            if (std::find(destinations.begin(), destinations.end(), &local_tmp) != destinations.end())
+            {
+                take_unsent_local_changes_nts(changeToSend.cacheChange, local_deliveries);
+            }
+
+            if (std::find(destinations.begin(), destinations.end(), &tmp) == destinations.end())
+            {
+                continue;
+            }
 
             // Remove the messages selected for sending from the original list,
             // and update those that were fragmented with the new sent index
             update_unsent_changes(changeToSend.sequenceNumber, changeToSend.fragmentNumber);
 
-            // Notify the controllers
-            FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
-
             if(changeToSend.fragmentNumber != 0)
             {
                 if(!group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, all_remote_readers_,
@@ -301,11 +399,6 @@ void StatelessWriter::send_any_unsent_changes()
                     logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
                 }
             }
-
-            if (bHasListener && is_acked_by_all(changeToSend.cacheChange))
-            {
-                mp_listener->onWriterChangeReceivedByAll(this, changeToSend.cacheChange);
-            }
         }
     }
     catch(const RTPSMessageGroup::timeout&)
@@ -313,6 +406,35 @@ void StatelessWriter::send_any_unsent_changes()
         logError(RTPS_WRITER, "Max blocking time reached");
     }
 
+    if (!local_deliveries.empty())
+    {
+        // Readers may notify their listeners, which may write on this writer
+        lock.unlock();
+        for (const LocalDelivery& delivery : local_deliveries)
+        {
+            intraprocess_delivery(delivery.second.get(), *delivery.first);
+        }
+        lock.lock();
+    }
+
+    if (mp_listener != nullptr && !sent_changes.empty())
+    {
+        // The changes are looked up again, as they may have been removed while the mutex was released
+        std::vector<CacheChange_t*> acked_changes;
+        for (auto cit = mp_history->changesBegin(); cit != mp_history->changesEnd(); ++cit)
+        {
+            if (sent_changes.count((*cit)->sequenceNumber) != 0 && is_acked_by_all(*cit))
+            {
+                acked_changes.push_back(*cit);
+            }
+        }
+
+        for (CacheChange_t* change : acked_changes)
+        {
+            mp_listener->onWriterChangeReceivedByAll(this, change);
+        }
+    }
+
     logInfo(RTPS_WRITER, "Finish sending unsent changes";);
 }
 
@@ -341,6 +463,34 @@ bool StatelessWriter::matched_reader_add(RemoteReaderAttributes& reader_attribut
         allLocatorLists.push_back(locators);
     }
 
+    for(const std::shared_ptr<LocalReaderPointer>& local_reader : matched_local_readers_)
+    {
+        if(local_reader->guid() == reader_attributes.guid)
+        {
+            logWarning(RTPS_WRITER, "Attempting to add existing reader");
+            return false;
+        }
+    }
+
+    // Readers living in this process are not reached through the transports
+    std::shared_ptr<LocalReaderPointer> local_reader = find_local_reader(reader_attributes.guid);
+    if (local_reader)
+    {
+        matched_local_readers_.push_back(local_reader);
+
+        if (reader_attributes.endpoint.durabilityKind >= TRANSIENT_LOCAL)
+        {
+            for (auto cit = mp_history->changesBegin(); cit != mp_history->changesEnd(); ++cit)
+            {
+                unsent_local_changes_.push_back({local_reader, *cit});
+            }
+            AsyncWriterThread::wakeUp(this);
+        }
+
+        logInfo(RTPS_READER,"Local reader " << reader_attributes.guid << " added to "<<m_guid.entityId);
+        return true;
+    }
+
     // Add info of new datareader.
     if (addGuid)
     {
@@ -405,6 +555,21 @@ bool StatelessWriter::matched_reader_remove(const RemoteReaderAttributes& reader
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
 
+    bool found_local = matched_local_readers_.remove_if(
+        [&reader_attributes](const std::shared_ptr<LocalReaderPointer>& local_reader)
+    {
+        return local_reader->guid() == reader_attributes.guid;
+    });
+    if (found_local)
+    {
+        unsent_local_changes_.erase(std::remove_if(unsent_local_changes_.begin(), unsent_local_changes_.end(),
+            [&reader_attributes](const LocalUnsentChange& local_change)
+        {
+            return local_change.reader->guid() == reader_attributes.guid;
+        }), unsent_local_changes_.end());
+        return true;
+    }
+
     bool found = matched_readers_.remove_if(reader_attributes.compare_guid_function());
     if (found)
     {
@@ -435,7 +600,12 @@ bool StatelessWriter::matched_reader_remove(const RemoteReaderAttributes& reader
 bool StatelessWriter::matched_reader_is_matched(const RemoteReaderAttributes& reader_attributes)
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
-    return std::any_of(matched_readers_.begin(), matched_readers_.end(), reader_attributes.compare_guid_function());
+    return std::any_of(matched_readers_.begin(), matched_readers_.end(), reader_attributes.compare_guid_function()) ||
+        std::any_of(matched_local_readers_.begin(), matched_local_readers_.end(),
+            [&reader_attributes](const std::shared_ptr<LocalReaderPointer>& local_reader)
+        {
+            return local_reader->guid() == reader_attributes.guid;
+        });
 }
 
 void StatelessWriter::unsent_changes_reset()
@@ -26,6 +26,7 @@
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/log/Log.h>
 
+#include <cassert>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -250,21 +251,7 @@ bool SubscriberHistory::received_change(
                     if ((int32_t)m_changes.size() == m_resourceLimitsQos.max_samples)
                         m_isHistoryFull = true;
                     //ADD TO KEY VECTOR
-                    if (vit->second.cache_changes.size() == 0)
-                    {
-                        vit->second.cache_changes.push_back(a_change);
-                    }
-                    else if (vit->second.cache_changes.back()->sequenceNumber < a_change->sequenceNumber)
-                    {
-                        vit->second.cache_changes.push_back(a_change);
-                    }
-                    else
-                    {
-                        vit->second.cache_changes.push_back(a_change);
-                        std::sort(vit->second.cache_changes.begin(),
-                                  vit->second.cache_changes.end(),
-                                  sort_ReaderHistoryCache);
-                    }
+                    add_to_instance(a_change, vit);
 
                     logInfo(SUBSCRIBER, this->mp_reader->getGuid().entityId
                         << ": Change " << a_change->sequenceNumber << " added from: "
@@ -486,25 +473,50 @@ bool SubscriberHistory::find_key(
         return true;
     }
 
-    if ((int)keyed_changes_.size() < m_resourceLimitsQos.max_instances)
+    if ((int)keyed_changes_.size() >= m_resourceLimitsQos.max_instances)
     {
-        *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-        return true;
+        if (empty_instances_.empty())
+        {
+            logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+            return false;
+        }
+
+        // Evict the instance that has been empty for longer
+        vit = keyed_changes_.find(empty_instances_.front());
+        assert(vit != keyed_changes_.end());
+        deadlines_.erase(vit->second.deadline_it);
+        empty_instances_.pop_front();
+        keyed_changes_.erase(vit);
+    }
+
+    vit = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedInstance())).first;
+    // New instances miss their deadline right away, until one is set
+    vit->second.deadline_it = deadlines_.insert(std::make_pair(vit->second.next_deadline_us, vit->first));
+    vit->second.empty_it = empty_instances_.insert(empty_instances_.end(), vit->first);
+    *vit_out = vit;
+    return true;
+}
+
+void SubscriberHistory::add_to_instance(
+        CacheChange_t* a_change,
+        t_m_Inst_Caches::iterator vit)
+{
+    std::vector<CacheChange_t*>& cache_changes = vit->second.cache_changes;
+
+    if (cache_changes.empty())
+    {
+        empty_instances_.erase(vit->second.empty_it);
+        cache_changes.push_back(a_change);
+    }
+    else if (cache_changes.back()->sequenceNumber < a_change->sequenceNumber)
+    {
+        cache_changes.push_back(a_change);
     }
     else
     {
-        for (vit = keyed_changes_.begin(); vit!= keyed_changes_.end(); ++vit)
-        {
-            if (vit->second.cache_changes.size() == 0)
-            {
-                keyed_changes_.erase(vit);
-                *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
-                return true;
-            }
-        }
-        logWarning(SUBSCRIBER, "History has reached the maximum number of instances");
+        cache_changes.push_back(a_change);
+        std::sort(cache_changes.begin(), cache_changes.end(), sort_ReaderHistoryCache);
     }
-    return false;
 }
 
 
@@ -541,6 +553,10 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change)
                 if (remove_change(change))
                 {
                     vit->second.cache_changes.erase(chit);
+                    if (vit->second.cache_changes.empty())
+                    {
+                        vit->second.empty_it = empty_instances_.insert(empty_instances_.end(), vit->first);
+                    }
                     m_isHistoryFull = false;
                     return true;
                 }
@@ -569,12 +585,15 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (mp_subImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        auto vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
+        deadlines_.erase(vit->second.deadline_it);
+        vit->second.deadline_it = deadlines_.insert(std::make_pair(next_deadline_us, handle));
         return true;
     }
 
@@ -599,14 +618,14 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (mp_subImpl->getAttributes().topic.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                                    keyed_changes_.end(),
-                                    [](
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &lhs,
-                                    const std::pair<InstanceHandle_t, KeyedChanges> &rhs)
-        { return lhs.second.next_deadline_us < rhs.second.next_deadline_us; });
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
+        if (deadlines_.empty())
+        {
+            return false;
+        }
+
+        auto min = deadlines_.begin();
+        handle = min->second;
+        next_deadline_us = min->first;
         return true;
     }
 
@@ -52,16 +52,12 @@ SubscriberImpl::SubscriberImpl(
     , m_readerListener(this)
     , mp_userSubscriber(nullptr)
     , mp_rtpsParticipant(nullptr)
-    , deadline_timer_(std::bind(&SubscriberImpl::deadline_missed, this),
-                      att.qos.m_deadline.period.to_ns() * 1e-6,
-                      mp_participant->get_resource_event().getIOService(),
-                      mp_participant->get_resource_event().getThread())
+    , timer_wheel_(mp_participant->get_resource_event().get_timer_wheel())
+    , deadline_timers_()
+    , closing_(false)
     , deadline_duration_us_(m_att.qos.m_deadline.period.to_ns() * 1e-3)
     , deadline_missed_status_()
-    , lifespan_timer_(std::bind(&SubscriberImpl::lifespan_expired, this),
-                      m_att.qos.m_lifespan.duration.to_ns() * 1e-6,
-                      mp_participant->get_resource_event().getIOService(),
-                      mp_participant->get_resource_event().getThread())
+    , lifespan_timer_(timer_wheel_, std::bind(&SubscriberImpl::lifespan_expired, this))
     , lifespan_duration_us_(m_att.qos.m_lifespan.duration.to_ns() * 1e-3)
 {
 }
@@ -73,6 +69,20 @@ SubscriberImpl::~SubscriberImpl()
         logInfo(SUBSCRIBER,this->getGuid().entityId << " in topic: "<<this->m_att.topic.topicName);
     }
 
+    // Timers are stopped before removing the reader, as their callbacks use it.
+    // Once closing, no deadline timer is added or erased, so they can be disabled without the reader mutex, which
+    // their callbacks take.
+    if(mp_reader != nullptr)
+    {
+        std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
+        closing_ = true;
+    }
+    for (auto& deadline_timer : deadline_timers_)
+    {
+        deadline_timer.second.disable();
+    }
+    lifespan_timer_.disable();
+
     RTPSDomain::removeRTPSReader(mp_reader);
     delete(this->mp_userSubscriber);
 }
@@ -187,11 +197,13 @@ bool SubscriberImpl::updateAttributes(const SubscriberAttributes& att)
         {
             deadline_duration_us_ =
                     duration<double, std::ratio<1, 1000000>>(m_att.qos.m_deadline.period.to_ns() * 1e-3);
-            deadline_timer_.update_interval_millisec(m_att.qos.m_deadline.period.to_ns() * 1e-6);
         }
         else
         {
-            deadline_timer_.cancel_timer();
+            for (auto& deadline_timer : deadline_timers_)
+            {
+                deadline_timer.second.cancel();
+            }
         }
 
         // Lifespan
@@ -200,11 +212,10 @@ bool SubscriberImpl::updateAttributes(const SubscriberAttributes& att)
         {
             lifespan_duration_us_ =
                     std::chrono::duration<double, std::ratio<1, 1000000>>(m_att.qos.m_lifespan.duration.to_ns() * 1e-3);
-            lifespan_timer_.update_interval_millisec(m_att.qos.m_lifespan.duration.to_ns() * 1e-6);
         }
         else
         {
-            lifespan_timer_.cancel_timer();
+            lifespan_timer_.cancel();
         }
     }
 
@@ -251,18 +262,10 @@ bool SubscriberImpl::onNewCacheChangeAdded(const CacheChange_t* const change_in)
 {
     if (m_att.qos.m_deadline.period != c_TimeInfinite)
     {
-        std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
-
-        if (!m_history.set_next_deadline(
-                    change_in->instanceHandle,
-                    steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
+        if (!deadline_timer_reschedule(change_in->instanceHandle))
         {
             logError(SUBSCRIBER, "Could not set next deadline in the history");
         }
-        else if (timer_owner_ == change_in->instanceHandle || timer_owner_ == InstanceHandle_t())
-        {
-            deadline_timer_reschedule();
-        }
     }
 
     CacheChange_t* change = (CacheChange_t*)change_in;
@@ -283,28 +286,15 @@ bool SubscriberImpl::onNewCacheChangeAdded(const CacheChange_t* const change_in)
         return false;
     }
 
-    CacheChange_t* earliest_change;
-    if (m_history.get_earliest_change(&earliest_change))
-    {
-        if (earliest_change == change)
-        {
-            // The new change has been added at the begining of the the history
-            // As the history is sorted by timestamp, this means that the new change has the smallest timestamp
-            // We have to stop the timer as this will be the next change to expire
-            lifespan_timer_.cancel_timer();
-        }
-    }
-    else
+    // Only the earliest expiration is scheduled, as expired changes are removed in order when the timer expires
+    auto interval = source_timestamp - now + lifespan_duration_us_;
+    auto expiration = steady_clock::now() + duration_cast<steady_clock::duration>(interval);
+
+    std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
+    if (!lifespan_timer_.is_scheduled() || expiration < lifespan_timer_.expiration())
     {
-        logError(SUBSCRIBER, "A change was added to history that could not be retrieved");
+        lifespan_timer_.schedule(expiration);
     }
-
-    auto interval = source_timestamp - now + duration_cast<nanoseconds>(lifespan_duration_us_);
-
-    // Update and restart the timer
-    // If the timer is already running this will not have any effect
-    lifespan_timer_.update_interval_millisec(interval.count() * 1e-6);
-    lifespan_timer_.restart_timer();
     return true;
 }
 
@@ -324,47 +314,68 @@ uint64_t SubscriberImpl::getUnreadCount() const
     return m_history.getUnreadCount();
 }
 
-void SubscriberImpl::deadline_timer_reschedule()
+bool SubscriberImpl::deadline_timer_reschedule(const InstanceHandle_t& handle)
 {
     assert(m_att.qos.m_deadline.period != c_TimeInfinite);
 
     std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
 
-    steady_clock::time_point next_deadline_us;
-    if (!m_history.get_next_deadline(timer_owner_, next_deadline_us))
+    if (closing_)
     {
-        logError(SUBSCRIBER, "Could not get the next deadline from the history");
-        return;
+        return false;
     }
-    auto interval_ms = duration_cast<milliseconds>(next_deadline_us - steady_clock::now());
 
-    deadline_timer_.cancel_timer();
-    deadline_timer_.update_interval_millisec((double)interval_ms.count());
-    deadline_timer_.restart_timer();
+    steady_clock::time_point next_deadline_us =
+        steady_clock::now() + duration_cast<steady_clock::duration>(deadline_duration_us_);
+    if (!m_history.set_next_deadline(handle, next_deadline_us))
+    {
+        // The instance was removed from the history, so its timer is not needed anymore.
+        // This may be called from the callback of the timer, which is allowed to destroy it.
+        deadline_timers_.erase(handle);
+        return false;
+    }
+
+    auto deadline_timer = deadline_timers_.find(handle);
+    if (deadline_timer == deadline_timers_.end())
+    {
+        deadline_timer = deadline_timers_.emplace(
+                std::piecewise_construct,
+                std::forward_as_tuple(handle),
+                std::forward_as_tuple(timer_wheel_, std::bind(&SubscriberImpl::deadline_missed, this, handle))).first;
+    }
+
+    deadline_timer->second.schedule(next_deadline_us);
+    return true;
 }
 
-void SubscriberImpl::deadline_missed()
+void SubscriberImpl::deadline_missed(const InstanceHandle_t& handle)
 {
-    assert(m_att.qos.m_deadline.period != c_TimeInfinite);
-
     std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
 
-    deadline_missed_status_.total_count++;
-    deadline_missed_status_.total_count_change++;
-    deadline_missed_status_.last_instance_handle = timer_owner_;
-    mp_listener->on_requested_deadline_missed(mp_userSubscriber, deadline_missed_status_);
-    deadline_missed_status_.total_count_change = 0;
+    // The instance could have received a sample, or the deadline could be disabled, while waiting for the mutex
+    if (closing_ || m_att.qos.m_deadline.period == c_TimeInfinite)
+    {
+        return;
+    }
 
-    if (!m_history.set_next_deadline(
-                timer_owner_,
-                steady_clock::now() + duration_cast<system_clock::duration>(deadline_duration_us_)))
+    auto deadline_timer = deadline_timers_.find(handle);
+    if (deadline_timer == deadline_timers_.end() || deadline_timer->second.is_scheduled())
     {
-        logError(SUBSCRIBER, "Could not set next deadline in the history");
         return;
     }
-    deadline_timer_reschedule();
-}
 
+    // Instances removed from the history do not miss deadlines
+    if (!deadline_timer_reschedule(handle))
+    {
+        return;
+    }
+
+    deadline_missed_status_.total_count++;
+    deadline_missed_status_.total_count_change++;
+    deadline_missed_status_.last_instance_handle = handle;
+    mp_listener->on_requested_deadline_missed(mp_userSubscriber, deadline_missed_status_);
+    deadline_missed_status_.total_count_change = 0;
+}
 
 void SubscriberImpl::get_requested_deadline_missed_status(RequestedDeadlineMissedStatus& status)
 {
@@ -378,42 +389,31 @@ void SubscriberImpl::lifespan_expired()
 {
     std::unique_lock<std::recursive_timed_mutex> lock(mp_reader->getMutex());
 
-    CacheChange_t* earliest_change;
-    if (!m_history.get_earliest_change(&earliest_change))
+    if (m_att.qos.m_lifespan.duration == c_TimeInfinite)
     {
         return;
     }
 
-    auto source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
-    auto now = system_clock::now();
-
-    // Check that the earliest change has expired (the change which started the timer could have been removed from the history)
-    if (now - source_timestamp < lifespan_duration_us_)
+    // Remove every expired change, and set the timer for the first one still alive
+    CacheChange_t* earliest_change;
+    while (m_history.get_earliest_change(&earliest_change))
     {
-        auto interval = source_timestamp - now + lifespan_duration_us_;
-        lifespan_timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-        lifespan_timer_.restart_timer();
-        return;
-    }
+        auto source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
+        auto now = system_clock::now();
 
-    // The earliest change has expired
-    m_history.remove_change_sub(earliest_change);
+        if (now - source_timestamp < lifespan_duration_us_)
+        {
+            auto interval = source_timestamp - now + lifespan_duration_us_;
+            lifespan_timer_.schedule(steady_clock::now() + duration_cast<steady_clock::duration>(interval));
+            return;
+        }
 
-    // Set the timer for the next change if there is one
-    if (!m_history.get_earliest_change(&earliest_change))
-    {
-        return;
+        if (!m_history.remove_change_sub(earliest_change))
+        {
+            logError(SUBSCRIBER, "Could not remove an expired change from the history");
+            return;
+        }
     }
-
-    // Calculate when the next change is due to expire and restart
-    source_timestamp = system_clock::time_point() + nanoseconds(earliest_change->sourceTimestamp.to_ns());
-    now = system_clock::now();
-    auto interval = source_timestamp - now + lifespan_duration_us_;
-
-    assert(interval.count() > 0);
-
-    lifespan_timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    lifespan_timer_.restart_timer();
 }
 
 void SubscriberImpl::get_liveliness_changed_status(LivelinessChangedStatus &status)
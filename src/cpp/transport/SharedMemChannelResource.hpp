@@ -0,0 +1,105 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __TRANSPORT_SHAREDMEMCHANNELRESOURCE_HPP__
+#define __TRANSPORT_SHAREDMEMCHANNELRESOURCE_HPP__
+
+#include <fastrtps/transport/ChannelResource.h>
+#include <fastrtps/transport/TransportReceiverInterface.h>
+
+#include "SharedMemSegment.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Listening thread of a shared memory port.
+ * Messages read from the segment are handed to the receiver from this thread.
+ */
+class SharedMemChannelResource : public ChannelResource
+{
+public:
+
+    SharedMemChannelResource(
+            std::shared_ptr<SharedMemSegment> segment,
+            uint32_t maxMsgSize,
+            const Locator_t& locator,
+            const Locator_t& remote_locator,
+            TransportReceiverInterface* receiver)
+        : ChannelResource(maxMsgSize)
+        , message_receiver_(receiver)
+        , segment_(std::move(segment))
+    {
+        // Messages written before the channel was opened are not delivered, as with a socket.
+        segment_->init_cursor(cursor_);
+        thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator, remote_locator));
+    }
+
+    virtual ~SharedMemChannelResource() override
+    {
+        message_receiver_ = nullptr;
+    }
+
+    virtual void disable() override
+    {
+        ChannelResource::disable();
+        segment_->wake_listeners();
+    }
+
+private:
+
+    //! Maximum time the listening thread sleeps before checking whether the channel is still alive.
+    static const uint32_t listen_timeout_ms = 100;
+
+    void perform_listen_operation(
+            Locator_t input_locator,
+            Locator_t remote_locator)
+    {
+        while (alive())
+        {
+            auto& msg = message_buffer();
+            if (!segment_->pop(cursor_, msg.buffer, msg.max_size, msg.length, listen_timeout_ms))
+            {
+                continue;
+            }
+
+            if (message_receiver_ != nullptr)
+            {
+                message_receiver_->OnDataReceived(msg.buffer, msg.length, input_locator, remote_locator);
+            }
+        }
+
+        message_receiver_ = nullptr;
+    }
+
+    TransportReceiverInterface* message_receiver_;
+
+    std::shared_ptr<SharedMemSegment> segment_;
+
+    SharedMemSegment::Cursor cursor_;
+
+    SharedMemChannelResource(const SharedMemChannelResource&) = delete;
+
+    SharedMemChannelResource& operator=(const SharedMemChannelResource&) = delete;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // __TRANSPORT_SHAREDMEMCHANNELRESOURCE_HPP__
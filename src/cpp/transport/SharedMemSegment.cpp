@@ -0,0 +1,534 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SharedMemSegment.hpp"
+
+#include <fastrtps/log/Log.h>
+
+#include <cstring>
+#include <new>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <climits>
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static const uint32_t c_segment_magic = 0x46534D53; // "FSMS"
+static const uint32_t c_segment_version = 1;
+static const size_t c_cache_line_size = 64;
+
+//! Times a sender yields waiting for the unfinished write of an older message on its slot.
+static const uint32_t c_max_claim_spins = 1000;
+
+//! Times opening a segment is retried while other processes create or remove it.
+static const uint32_t c_max_open_attempts = 100;
+
+//! Timed out waits after which a listener skips a message that was reserved but never published.
+static const uint32_t c_max_stalled_waits = 2;
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32 bits integer");
+
+struct SharedMemSegment::SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t slot_size;
+    uint64_t slot_stride;
+
+    //! Ticket of the next message to be written.
+    alignas(64) std::atomic<uint64_t> write_ticket;
+
+    //! Futex word. Increased every time a message is published.
+    alignas(64) std::atomic<uint32_t> notify_value;
+    //! Number of listeners sleeping on the futex.
+    std::atomic<uint32_t> waiters;
+};
+
+struct SharedMemSegment::SlotHeader
+{
+    //! 2 * (ticket + 1) when the message with that ticket is published, one less while it is being written.
+    std::atomic<uint64_t> state;
+    uint32_t size;
+    uint32_t reserved;
+};
+
+static inline size_t round_to_cache_line(size_t size)
+{
+    return (size + c_cache_line_size - 1) & ~(c_cache_line_size - 1);
+}
+
+SharedMemSegment::SharedMemSegment(
+        const std::string& name,
+        int fd,
+        void* base,
+        size_t size)
+    : name_(name)
+    , fd_(fd)
+    , base_(base)
+    , size_(size)
+    , header_(static_cast<SegmentHeader*>(base))
+    , slots_(static_cast<octet*>(base) + round_to_cache_line(sizeof(SegmentHeader)))
+{
+}
+
+SharedMemSegment::~SharedMemSegment()
+{
+#if defined(__linux__)
+    munmap(base_, size_);
+
+    // Every user holds a shared lock, so getting the exclusive one means this is the last user.
+    if (flock(fd_, LOCK_EX | LOCK_NB) == 0)
+    {
+        shm_unlink(name_.c_str());
+    }
+
+    close(fd_);
+#endif
+}
+
+bool SharedMemSegment::is_supported()
+{
+#if defined(__linux__)
+    std::atomic<uint64_t> probe(0);
+    return probe.is_lock_free();
+#else
+    return false;
+#endif
+}
+
+std::shared_ptr<SharedMemSegment> SharedMemSegment::open(
+        const std::string& name,
+        uint32_t slot_count,
+        uint32_t slot_size,
+        uint32_t permissions)
+{
+    return open(name, true, slot_count, slot_size, permissions);
+}
+
+std::shared_ptr<SharedMemSegment> SharedMemSegment::open_existing(const std::string& name)
+{
+    return open(name, false, 0, 0, 0);
+}
+
+void SharedMemSegment::remove_unused(const std::string& name_prefix)
+{
+#if defined(__linux__)
+    DIR* shm_dir = opendir("/dev/shm");
+    if (shm_dir == nullptr)
+    {
+        return;
+    }
+
+    const std::string file_prefix = name_prefix + "_";
+    std::vector<std::string> names;
+    while (struct dirent* entry = readdir(shm_dir))
+    {
+        std::string file_name(entry->d_name);
+        if (file_name.size() > file_prefix.size() && file_name.compare(0, file_prefix.size(), file_prefix) == 0 &&
+                file_name.find_first_not_of("0123456789", file_prefix.size()) == std::string::npos)
+        {
+            names.push_back("/" + file_name);
+        }
+    }
+    closedir(shm_dir);
+
+    for (const std::string& name : names)
+    {
+        int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        // Every user holds a shared lock, so getting the exclusive one means nobody uses it. A process that
+        // opened it meanwhile sees it unlinked once it gets the lock, and opens it again.
+        if (flock(fd, LOCK_EX | LOCK_NB) == 0)
+        {
+            logInfo(RTPS_MSG_OUT, "Removing unused shared memory segment " << name);
+            shm_unlink(name.c_str());
+        }
+
+        close(fd);
+    }
+#else
+    (void)name_prefix;
+#endif
+}
+
+std::shared_ptr<SharedMemSegment> SharedMemSegment::open(
+        const std::string& name,
+        bool create,
+        uint32_t slot_count,
+        uint32_t slot_size,
+        uint32_t permissions)
+{
+#if defined(__linux__)
+    const size_t header_size = round_to_cache_line(sizeof(SegmentHeader));
+    const size_t slot_stride = round_to_cache_line(sizeof(SlotHeader) + slot_size);
+
+    // The last user unlinks the segment when closing it, so the object opened may be removed before being
+    // locked. Opening is then retried, which creates a new one.
+    for (uint32_t attempt = 0; attempt < c_max_open_attempts; ++attempt)
+    {
+        int fd = shm_open(name.c_str(), create ? (O_CREAT | O_RDWR) : O_RDWR, static_cast<mode_t>(permissions));
+        if (fd < 0 && !create && errno == ENOENT)
+        {
+            // Nobody listens on it.
+            return nullptr;
+        }
+        else if (fd < 0)
+        {
+            logWarning(RTPS_MSG_OUT, "Cannot open shared memory segment " << name << ": " << strerror(errno));
+            return nullptr;
+        }
+
+        // Users hold a shared lock, so the exclusive one is only granted when nobody else uses the segment,
+        // and that process may initialize it. The rest wait on the shared lock until it is initialized.
+        bool is_exclusive = flock(fd, LOCK_EX | LOCK_NB) == 0;
+        if (!is_exclusive && flock(fd, LOCK_SH) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        struct stat opened_stat;
+        if (fstat(fd, &opened_stat) != 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        struct stat linked_stat;
+        bool is_linked = false;
+        int linked_fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (linked_fd >= 0)
+        {
+            is_linked = fstat(linked_fd, &linked_stat) == 0 &&
+                opened_stat.st_dev == linked_stat.st_dev && opened_stat.st_ino == linked_stat.st_ino;
+            close(linked_fd);
+        }
+
+        size_t size = static_cast<size_t>(opened_stat.st_size);
+        if (!is_linked || (size == 0 && !is_exclusive))
+        {
+            // Removed by its last user, or still being created by another process.
+            close(fd);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        bool created = (size == 0);
+        if (created && !create)
+        {
+            // Left empty by a process that died while creating it.
+            close(fd);
+            return nullptr;
+        }
+        else if (created)
+        {
+            // The mode given to shm_open is narrowed by the umask.
+            if (fchmod(fd, static_cast<mode_t>(permissions)) != 0)
+            {
+                logWarning(RTPS_MSG_OUT, "Cannot set permissions of shared memory segment " << name << ": "
+                        << strerror(errno));
+            }
+
+            size = header_size + slot_stride * slot_count;
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+            {
+                logWarning(RTPS_MSG_OUT, "Cannot size shared memory segment " << name << ": " << strerror(errno));
+                shm_unlink(name.c_str());
+                close(fd);
+                return nullptr;
+            }
+        }
+        else if (size < header_size)
+        {
+            logWarning(RTPS_MSG_OUT, "Shared memory segment " << name << " is corrupted");
+            close(fd);
+            return nullptr;
+        }
+
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED)
+        {
+            logWarning(RTPS_MSG_OUT, "Cannot map shared memory segment " << name << ": " << strerror(errno));
+            close(fd);
+            return nullptr;
+        }
+
+        SegmentHeader* header = static_cast<SegmentHeader*>(base);
+        if (created)
+        {
+            // Slots are zero filled by ftruncate, which marks them as empty.
+            header = new (base) SegmentHeader();
+            header->magic = c_segment_magic;
+            header->version = c_segment_version;
+            header->slot_count = slot_count;
+            header->slot_size = slot_size;
+            header->slot_stride = slot_stride;
+        }
+        else if (header->magic != c_segment_magic || header->version != c_segment_version ||
+                header->slot_count == 0 || header_size + header->slot_stride * header->slot_count > size)
+        {
+            logWarning(RTPS_MSG_OUT, "Shared memory segment " << name << " has an incompatible format");
+            munmap(base, size);
+            close(fd);
+            return nullptr;
+        }
+
+        if (is_exclusive)
+        {
+            flock(fd, LOCK_SH);
+        }
+
+        return std::shared_ptr<SharedMemSegment>(new SharedMemSegment(name, fd, base, size));
+    }
+
+    logWarning(RTPS_MSG_OUT, "Cannot open shared memory segment " << name << ": removed while opening");
+#else
+    (void)name;
+    (void)create;
+    (void)slot_count;
+    (void)slot_size;
+    (void)permissions;
+#endif
+
+    return nullptr;
+}
+
+bool SharedMemSegment::lock_exclusive_listener()
+{
+#if defined(__linux__) && defined(F_OFD_SETLK)
+    // Open file description locks are owned by this descriptor, so they also exclude other listeners in
+    // this same process, and are released by the system when the process dies.
+    struct flock listener_lock;
+    memset(&listener_lock, 0, sizeof(listener_lock));
+    listener_lock.l_type = F_WRLCK;
+    listener_lock.l_whence = SEEK_SET;
+    listener_lock.l_start = 0;
+    listener_lock.l_len = 1;
+
+    return fcntl(fd_, F_OFD_SETLK, &listener_lock) == 0;
+#else
+    return false;
+#endif
+}
+
+uint32_t SharedMemSegment::slot_size() const
+{
+    return header_->slot_size;
+}
+
+SharedMemSegment::SlotHeader& SharedMemSegment::slot_at(uint64_t ticket) const
+{
+    return *reinterpret_cast<SlotHeader*>(slots_ + (ticket % header_->slot_count) * header_->slot_stride);
+}
+
+void SharedMemSegment::init_cursor(Cursor& cursor) const
+{
+    cursor.next = header_->write_ticket.load();
+    cursor.stalled_waits = 0;
+}
+
+bool SharedMemSegment::push(
+        const NetworkBuffer* buffers,
+        size_t count,
+        uint32_t total_bytes)
+{
+    if (total_bytes > header_->slot_size)
+    {
+        return false;
+    }
+
+    uint64_t ticket = header_->write_ticket.fetch_add(1);
+    SlotHeader& slot = slot_at(ticket);
+    const uint64_t writing = 2 * ticket + 1;
+
+    uint64_t state = slot.state.load();
+    uint32_t spins = 0;
+    for (;;)
+    {
+        if (state >= writing)
+        {
+            // A newer message already took the slot, so this one would never be read.
+            return false;
+        }
+
+        if ((state & 1u) != 0 && spins < c_max_claim_spins)
+        {
+            // The sender of the message being replaced has not finished yet.
+            ++spins;
+            std::this_thread::yield();
+            state = slot.state.load();
+        }
+        else if (slot.state.compare_exchange_weak(state, writing))
+        {
+            break;
+        }
+    }
+
+    // Listeners copying the previous message must see the slot as being written before its data changes.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    octet* data = reinterpret_cast<octet*>(&slot + 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        memcpy(data, buffers[i].buffer, buffers[i].size);
+        data += buffers[i].size;
+    }
+    slot.size = total_bytes;
+    slot.state.store(writing + 1, std::memory_order_release);
+
+    notify();
+    return true;
+}
+
+bool SharedMemSegment::pop(
+        Cursor& cursor,
+        octet* buffer,
+        uint32_t max_size,
+        uint32_t& length,
+        uint32_t timeout_ms)
+{
+    const uint64_t slot_count = header_->slot_count;
+
+    for (;;)
+    {
+        uint32_t notify_value = header_->notify_value.load();
+        uint64_t write_ticket = header_->write_ticket.load();
+
+        if (write_ticket - cursor.next > slot_count)
+        {
+            // The listener fell behind and the oldest messages were overwritten.
+            cursor.next = write_ticket - slot_count;
+            cursor.stalled_waits = 0;
+        }
+
+        if (cursor.next < write_ticket)
+        {
+            SlotHeader& slot = slot_at(cursor.next);
+            const uint64_t published = 2 * cursor.next + 2;
+            uint64_t state = slot.state.load(std::memory_order_acquire);
+
+            if (state == published)
+            {
+                uint32_t size = slot.size;
+                bool fits = size <= max_size && size <= header_->slot_size;
+                if (fits)
+                {
+                    memcpy(buffer, reinterpret_cast<const octet*>(&slot + 1), size);
+                }
+
+                // The copy is only valid if no sender took the slot meanwhile.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                bool valid = slot.state.load(std::memory_order_relaxed) == published;
+
+                ++cursor.next;
+                cursor.stalled_waits = 0;
+
+                if (fits && valid)
+                {
+                    length = size;
+                    return true;
+                }
+                continue;
+            }
+            else if (state > published || cursor.stalled_waits >= c_max_stalled_waits)
+            {
+                // Either overwritten by a newer message, or reserved by a sender that never published it.
+                ++cursor.next;
+                cursor.stalled_waits = 0;
+                continue;
+            }
+        }
+
+        if (!wait(notify_value, timeout_ms))
+        {
+            if (cursor.next < write_ticket)
+            {
+                ++cursor.stalled_waits;
+            }
+            return false;
+        }
+    }
+}
+
+bool SharedMemSegment::wait(
+        uint32_t notify_value,
+        uint32_t timeout_ms)
+{
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeout_ms / 1000);
+    timeout.tv_nsec = static_cast<long>(timeout_ms % 1000) * 1000000;
+
+    header_->waiters.fetch_add(1);
+    long ret = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header_->notify_value), FUTEX_WAIT,
+            notify_value, &timeout, nullptr, 0);
+    int error = errno;
+    header_->waiters.fetch_sub(1);
+
+    return ret == 0 || error != ETIMEDOUT;
+#else
+    (void)notify_value;
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+    return false;
+#endif
+}
+
+void SharedMemSegment::notify()
+{
+    header_->notify_value.fetch_add(1);
+
+    // Listeners register before sleeping, so the futex is only entered when someone may be waiting.
+    if (header_->waiters.load() != 0)
+    {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header_->notify_value), FUTEX_WAKE, INT_MAX,
+                nullptr, nullptr, 0);
+#endif
+    }
+}
+
+void SharedMemSegment::wake_listeners()
+{
+    header_->notify_value.fetch_add(1);
+
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header_->notify_value), FUTEX_WAKE, INT_MAX,
+            nullptr, nullptr, 0);
+#endif
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
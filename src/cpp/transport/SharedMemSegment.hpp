@@ -0,0 +1,182 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __TRANSPORT_SHAREDMEMSEGMENT_HPP__
+#define __TRANSPORT_SHAREDMEMSEGMENT_HPP__
+
+#include <fastrtps/rtps/common/NetworkBuffer.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Shared memory object holding the message queue of one port.
+ *
+ * The queue is a lock-free ring of fixed size slots, shared by every process on the host using the port.
+ * Any number of senders reserve slots with an atomic ticket and publish them with a per-slot sequence,
+ * and every listener of the port reads all messages with its own cursor, so unicast and multicast
+ * behave the same way. Slow listeners lose the messages that were overwritten, as with a full socket
+ * buffer. Listeners block on a futex in the segment, which senders only wake when someone is waiting.
+ *
+ * The object is removed from the system when the last process using it closes it.
+ */
+class SharedMemSegment
+{
+public:
+
+    //! Read position of a listener in the ring.
+    struct Cursor
+    {
+        Cursor()
+            : next(0)
+            , stalled_waits(0)
+        {
+        }
+
+        //! Ticket of the next message to read.
+        uint64_t next;
+        //! Timed out waits while the next message was reserved but not published.
+        uint32_t stalled_waits;
+    };
+
+    /**
+     * Opens the segment with the given name, creating and initializing it if it does not exist.
+     * Geometry parameters are only used when the segment is created.
+     * @param name Name of the shared memory object.
+     * @param slot_count Number of messages the ring can hold.
+     * @param slot_size Maximum size of a message.
+     * @param permissions Access mode given to the segment when it is created.
+     * @return The segment, or nullptr on error.
+     */
+    static std::shared_ptr<SharedMemSegment> open(
+            const std::string& name,
+            uint32_t slot_count,
+            uint32_t slot_size,
+            uint32_t permissions);
+
+    /**
+     * Opens the segment with the given name only if it already exists, as done by senders.
+     * @param name Name of the shared memory object.
+     * @return The segment, or nullptr if it does not exist or on error.
+     */
+    static std::shared_ptr<SharedMemSegment> open_existing(const std::string& name);
+
+    /**
+     * Removes the segments left by processes that died without closing them.
+     * Only segments nobody uses are removed, so this is safe while other processes run.
+     * @param name_prefix Prefix of the names of the segments, as given to open.
+     */
+    static void remove_unused(const std::string& name_prefix);
+
+    //! Whether shared memory segments can be used on this platform.
+    static bool is_supported();
+
+    ~SharedMemSegment();
+
+    /**
+     * Writes a message, described as an ordered list of buffers, into the ring.
+     * @param buffers Buffers composing the message.
+     * @param count Number of buffers.
+     * @param total_bytes Sum of the sizes of all buffers.
+     * @return false when the message does not fit in a slot or was overrun before being published.
+     */
+    bool push(
+            const NetworkBuffer* buffers,
+            size_t count,
+            uint32_t total_bytes);
+
+    /**
+     * Reserves the exclusive right to listen on this segment, as done by unicast locators.
+     * The reservation is held until the segment is closed, and is released by the system if the process dies.
+     * @return false if another listener holds it.
+     */
+    bool lock_exclusive_listener();
+
+    //! Places a cursor on the next message that will be written.
+    void init_cursor(Cursor& cursor) const;
+
+    /**
+     * Reads the next message of a cursor, waiting for it a maximum of timeout_ms.
+     * @param cursor Cursor of the listener.
+     * @param buffer Buffer where the message is copied.
+     * @param max_size Size of the buffer.
+     * @param length Length of the received message.
+     * @param timeout_ms Maximum time to wait.
+     * @return true if a message was copied.
+     */
+    bool pop(
+            Cursor& cursor,
+            octet* buffer,
+            uint32_t max_size,
+            uint32_t& length,
+            uint32_t timeout_ms);
+
+    //! Wakes every listener waiting on the segment.
+    void wake_listeners();
+
+    uint32_t slot_size() const;
+
+private:
+
+    struct SegmentHeader;
+    struct SlotHeader;
+
+    SharedMemSegment(
+            const std::string& name,
+            int fd,
+            void* base,
+            size_t size);
+
+    static std::shared_ptr<SharedMemSegment> open(
+            const std::string& name,
+            bool create,
+            uint32_t slot_count,
+            uint32_t slot_size,
+            uint32_t permissions);
+
+    SlotHeader& slot_at(uint64_t ticket) const;
+
+    bool wait(
+            uint32_t notify_value,
+            uint32_t timeout_ms);
+
+    void notify();
+
+    std::string name_;
+
+    int fd_;
+
+    void* base_;
+
+    size_t size_;
+
+    SegmentHeader* header_;
+
+    octet* slots_;
+
+    SharedMemSegment(const SharedMemSegment&) = delete;
+
+    SharedMemSegment& operator=(const SharedMemSegment&) = delete;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // __TRANSPORT_SHAREDMEMSEGMENT_HPP__
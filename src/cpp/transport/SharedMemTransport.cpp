@@ -0,0 +1,524 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/transport/SharedMemTransport.h>
+#include <fastrtps/log/Log.h>
+
+#include "SharedMemSegment.hpp"
+#include "SharedMemChannelResource.hpp"
+#include "SharedMemSenderResource.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+static const uint32_t s_defaultPortQueueCapacity = 64;
+static const char* const s_defaultSegmentNamePrefix = "fastrtps_shm";
+static const uint32_t s_defaultSegmentPermissions = 0600;
+
+//! Identifies the host, so locators of other hosts are told apart. Processes sharing a kernel share it.
+static uint32_t compute_host_id()
+{
+    std::string host;
+
+#if defined(__linux__)
+    std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+    std::getline(boot_id, host);
+
+    char host_name[256];
+    if (gethostname(host_name, sizeof(host_name)) == 0)
+    {
+        host_name[sizeof(host_name) - 1] = '\0';
+        host += host_name;
+    }
+#endif
+
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (char c : host)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+
+    // Zero is reserved for locators without host.
+    return hash != 0 ? hash : 1;
+}
+
+static inline uint32_t get_host_id(const Locator_t& locator)
+{
+    return (static_cast<uint32_t>(locator.address[12]) << 24) |
+        (static_cast<uint32_t>(locator.address[13]) << 16) |
+        (static_cast<uint32_t>(locator.address[14]) << 8) |
+        static_cast<uint32_t>(locator.address[15]);
+}
+
+static inline bool is_multicast(const Locator_t& locator)
+{
+    return locator.address[0] == 0xFF;
+}
+
+SharedMemTransportDescriptor::SharedMemTransportDescriptor()
+    : TransportDescriptorInterface(s_maximumMessageSize, s_maximumInitialPeersRange)
+    , port_queue_capacity(s_defaultPortQueueCapacity)
+    , segment_name_prefix(s_defaultSegmentNamePrefix)
+    , segment_permissions(s_defaultSegmentPermissions)
+{
+}
+
+SharedMemTransportDescriptor::SharedMemTransportDescriptor(const SharedMemTransportDescriptor& t)
+    : TransportDescriptorInterface(t)
+    , port_queue_capacity(t.port_queue_capacity)
+    , segment_name_prefix(t.segment_name_prefix)
+    , segment_permissions(t.segment_permissions)
+{
+}
+
+TransportInterface* SharedMemTransportDescriptor::create_transport() const
+{
+    return new SharedMemTransport(*this);
+}
+
+uint32_t SharedMemTransportDescriptor::min_send_buffer_size() const
+{
+    return maxMessageSize;
+}
+
+SharedMemTransport::SharedMemTransport(const SharedMemTransportDescriptor& descriptor)
+    : TransportInterface(LOCATOR_KIND_SHM)
+    , configuration_(descriptor)
+    , host_id_(compute_host_id())
+{
+}
+
+SharedMemTransport::~SharedMemTransport()
+{
+    std::vector<Locator_t> open_locators;
+    {
+        std::lock_guard<std::recursive_mutex> lock(input_channels_mutex_);
+        for (auto& channel : input_channels_)
+        {
+            open_locators.emplace_back(transport_kind_, channel.first);
+        }
+    }
+
+    for (const Locator_t& locator : open_locators)
+    {
+        CloseInputChannel(locator);
+    }
+}
+
+bool SharedMemTransport::init()
+{
+    if (!SharedMemSegment::is_supported())
+    {
+        logError(RTPS_MSG_OUT, "Shared memory transport is not supported on this platform");
+        return false;
+    }
+
+    if (configuration_.maxMessageSize > s_maximumMessageSize)
+    {
+        logError(RTPS_MSG_OUT, "maxMessageSize cannot be greater than 65000");
+        return false;
+    }
+
+    if (configuration_.port_queue_capacity == 0)
+    {
+        logError(RTPS_MSG_OUT, "port_queue_capacity cannot be zero");
+        return false;
+    }
+
+    if (configuration_.segment_permissions > 0777)
+    {
+        logError(RTPS_MSG_OUT, "segment_permissions can only hold permission bits");
+        return false;
+    }
+
+    SharedMemSegment::remove_unused(configuration_.segment_name_prefix);
+
+    return true;
+}
+
+bool SharedMemTransport::IsInputChannelOpen(const Locator_t& locator) const
+{
+    std::lock_guard<std::recursive_mutex> lock(input_channels_mutex_);
+    return IsLocatorSupported(locator) && input_channels_.find(locator.port) != input_channels_.end();
+}
+
+bool SharedMemTransport::IsLocatorSupported(const Locator_t& locator) const
+{
+    return locator.kind == transport_kind_;
+}
+
+bool SharedMemTransport::is_locator_allowed(const Locator_t& locator) const
+{
+    return is_local_locator(locator);
+}
+
+bool SharedMemTransport::is_local_locator(const Locator_t& locator) const
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    uint32_t host_id = get_host_id(locator);
+    return host_id == 0 || host_id == host_id_;
+}
+
+Locator_t SharedMemTransport::RemoteToMainLocal(const Locator_t& remote) const
+{
+    Locator_t mainLocal(remote);
+    mainLocal.port = 0;
+    mainLocal.set_Invalid_Address();
+    fill_local_address(mainLocal);
+    return mainLocal;
+}
+
+bool SharedMemTransport::OpenOutputChannel(
+        SendResourceList& sender_resource_list,
+        const Locator_t& locator)
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    // A single sender resource writes on the segment of any port.
+    for (auto& sender_resource : sender_resource_list)
+    {
+        if (SharedMemSenderResource::cast(*this, sender_resource.get()) != nullptr)
+        {
+            return true;
+        }
+    }
+
+    sender_resource_list.emplace_back(static_cast<SenderResource*>(new SharedMemSenderResource(*this)));
+    return true;
+}
+
+bool SharedMemTransport::OpenInputChannel(
+        const Locator_t& locator,
+        TransportReceiverInterface* receiver,
+        uint32_t maxMsgSize)
+{
+    std::lock_guard<std::recursive_mutex> lock(input_channels_mutex_);
+
+    if (!is_locator_allowed(locator) || IsInputChannelOpen(locator))
+    {
+        return false;
+    }
+
+    std::shared_ptr<SharedMemSegment> segment = SharedMemSegment::open(segment_name(locator.port),
+            configuration_.port_queue_capacity, configuration_.maxMessageSize,
+            configuration_.segment_permissions);
+    if (!segment)
+    {
+        return false;
+    }
+
+    if (!is_multicast(locator) && !segment->lock_exclusive_listener())
+    {
+        logInfo(RTPS_MSG_OUT, "SharedMemTransport port " << locator.port << " is already in use");
+        return false;
+    }
+
+    Locator_t remote_locator(transport_kind_, 0);
+    fill_local_address(remote_locator);
+
+    input_channels_[locator.port] = new SharedMemChannelResource(segment, maxMsgSize, locator, remote_locator,
+            receiver);
+    return true;
+}
+
+bool SharedMemTransport::CloseInputChannel(const Locator_t& locator)
+{
+    SharedMemChannelResource* channel = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> lock(input_channels_mutex_);
+        if (!IsInputChannelOpen(locator))
+        {
+            return false;
+        }
+
+        auto it = input_channels_.find(locator.port);
+        channel = it->second;
+        input_channels_.erase(it);
+    }
+
+    channel->disable();
+    channel->clear();
+    delete channel;
+
+    return true;
+}
+
+bool SharedMemTransport::DoInputLocatorsMatch(
+        const Locator_t& left,
+        const Locator_t& right) const
+{
+    return IsLocatorSupported(left) && IsLocatorSupported(right) && left.port == right.port;
+}
+
+LocatorList_t SharedMemTransport::NormalizeLocator(const Locator_t& locator)
+{
+    LocatorList_t list;
+
+    Locator_t normalized(locator);
+    if (get_host_id(normalized) == 0)
+    {
+        fill_local_address(normalized);
+    }
+    list.push_back(normalized);
+
+    return list;
+}
+
+LocatorList_t SharedMemTransport::ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists)
+{
+    LocatorList_t result;
+
+    for (const LocatorList_t& locatorList : locatorLists)
+    {
+        LocatorList_t multicast;
+        LocatorList_t unicast;
+
+        for (const Locator_t& locator : locatorList)
+        {
+            // Segments of other hosts cannot be reached.
+            if (!is_local_locator(locator))
+            {
+                continue;
+            }
+
+            if (is_multicast(locator))
+            {
+                multicast.push_back(locator);
+            }
+            else
+            {
+                unicast.push_back(locator);
+            }
+        }
+
+        // Every listener of a port reads all its messages, so multicast ones already reach this entity.
+        result.push_back(multicast.empty() ? unicast : multicast);
+    }
+
+    return result;
+}
+
+void SharedMemTransport::AddDefaultOutputLocator(LocatorList_t&)
+{
+}
+
+bool SharedMemTransport::getDefaultMetatrafficMulticastLocators(
+        LocatorList_t& locators,
+        uint32_t metatraffic_multicast_port) const
+{
+    Locator_t locator(transport_kind_, metatraffic_multicast_port);
+    locator.address[0] = 0xFF;
+    fill_local_address(locator);
+    locators.push_back(locator);
+    return true;
+}
+
+bool SharedMemTransport::getDefaultMetatrafficUnicastLocators(
+        LocatorList_t& locators,
+        uint32_t metatraffic_unicast_port) const
+{
+    Locator_t locator(transport_kind_, metatraffic_unicast_port);
+    fill_local_address(locator);
+    locators.push_back(locator);
+    return true;
+}
+
+bool SharedMemTransport::getDefaultUnicastLocators(
+        LocatorList_t& locators,
+        uint32_t unicast_port) const
+{
+    Locator_t locator(transport_kind_, unicast_port);
+    fill_local_address(locator);
+    locators.push_back(locator);
+    return true;
+}
+
+bool SharedMemTransport::fillMetatrafficMulticastLocator(
+        Locator_t& locator,
+        uint32_t metatraffic_multicast_port) const
+{
+    return fillUnicastLocator(locator, metatraffic_multicast_port);
+}
+
+bool SharedMemTransport::fillMetatrafficUnicastLocator(
+        Locator_t& locator,
+        uint32_t metatraffic_unicast_port) const
+{
+    return fillUnicastLocator(locator, metatraffic_unicast_port);
+}
+
+bool SharedMemTransport::configureInitialPeerLocator(
+        Locator_t& locator,
+        const PortParameters& port_params,
+        uint32_t domainId,
+        LocatorList_t& list) const
+{
+    Locator_t peer(locator);
+    if (get_host_id(peer) == 0)
+    {
+        fill_local_address(peer);
+    }
+
+    if (peer.port == 0)
+    {
+        for (uint32_t i = 0; i < configuration_.maxInitialPeersRange; ++i)
+        {
+            Locator_t auxloc(peer);
+            auxloc.port = port_params.getUnicastPort(domainId, i);
+
+            list.push_back(auxloc);
+        }
+    }
+    else
+    {
+        list.push_back(peer);
+    }
+
+    return true;
+}
+
+bool SharedMemTransport::fillUnicastLocator(
+        Locator_t& locator,
+        uint32_t well_known_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = well_known_port;
+    }
+
+    if (get_host_id(locator) == 0)
+    {
+        fill_local_address(locator);
+    }
+
+    return true;
+}
+
+bool SharedMemTransport::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        const Locator_t& remote_locator)
+{
+    NetworkBuffer buffer(send_buffer, send_buffer_size);
+    return send_to_segment(&buffer, 1, send_buffer_size, remote_locator);
+}
+
+bool SharedMemTransport::send(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        const LocatorList_t& remote_locators)
+{
+    bool success = false;
+
+    for (const Locator_t& remote_locator : remote_locators)
+    {
+        success |= send_to_segment(buffers.data(), buffers.size(), total_bytes, remote_locator);
+    }
+
+    return success;
+}
+
+bool SharedMemTransport::send_to_segment(
+        const NetworkBuffer* buffers,
+        size_t count,
+        uint32_t total_bytes,
+        const Locator_t& remote_locator)
+{
+    if (!is_local_locator(remote_locator))
+    {
+        return false;
+    }
+
+    if (total_bytes > configuration_.maxMessageSize)
+    {
+        logWarning(RTPS_MSG_OUT, "send length " << total_bytes << " exceeds maxMessageSize "
+            << configuration_.maxMessageSize);
+        return false;
+    }
+
+    std::shared_ptr<SharedMemSegment> segment = get_output_segment(remote_locator.port);
+    if (!segment)
+    {
+        return false;
+    }
+
+    if (!segment->push(buffers, count, total_bytes))
+    {
+        // Do not keep the segment alive for a listener that may be gone. It is opened again on the next send.
+        std::lock_guard<std::mutex> lock(output_segments_mutex_);
+        auto it = output_segments_.find(remote_locator.port);
+        if (it != output_segments_.end() && it->second == segment)
+        {
+            output_segments_.erase(it);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<SharedMemSegment> SharedMemTransport::get_output_segment(uint32_t port)
+{
+    std::lock_guard<std::mutex> lock(output_segments_mutex_);
+
+    auto it = output_segments_.find(port);
+    if (it != output_segments_.end())
+    {
+        return it->second;
+    }
+
+    // Segments are created by their listeners, so ports nobody listens on, like most initial peers, cost nothing.
+    std::shared_ptr<SharedMemSegment> segment = SharedMemSegment::open_existing(segment_name(port));
+    if (segment)
+    {
+        output_segments_[port] = segment;
+    }
+
+    return segment;
+}
+
+std::string SharedMemTransport::segment_name(uint32_t port) const
+{
+    return "/" + configuration_.segment_name_prefix + "_" + std::to_string(port);
+}
+
+void SharedMemTransport::fill_local_address(Locator_t& locator) const
+{
+    locator.address[12] = static_cast<octet>(host_id_ >> 24);
+    locator.address[13] = static_cast<octet>(host_id_ >> 16);
+    locator.address[14] = static_cast<octet>(host_id_ >> 8);
+    locator.address[15] = static_cast<octet>(host_id_);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -18,6 +18,7 @@
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/utils/eClock.h>
 
+#include <array>
 #include <future>
 
 using namespace asio;
@@ -146,18 +147,14 @@ size_t TCPChannelResourceBasic::send(
 
     if (eConnecting < connection_status_)
     {
-        std::unique_lock<std::mutex> write_lock(write_mutex_);
-
-
-        if (header_size > 0)
-        {
-            bytes_sent = socket_->send(asio::buffer(header, header_size), 0, ec);
-        }
+        // Header and payload go in a single gathered write, which also completes partial writes.
+        std::array<asio::const_buffer, 2> buffers = {{
+            asio::buffer(header, header_size),
+            asio::buffer(data, size)
+        }};
 
-        if (!ec)
-        {
-            bytes_sent += socket_->send(asio::buffer(data, size), 0, ec);
-        }
+        std::unique_lock<std::mutex> write_lock(write_mutex_);
+        bytes_sent = asio::write(*socket_, buffers, ec);
     }
 
     return  bytes_sent;
@@ -1007,36 +1007,32 @@ bool TCPTransportInterface::send(
     {
         uint16_t logical_port = IPLocator::getLogicalPort(remote_locator);
 
-        if (channel->is_logical_port_added(logical_port))
+        // Opened ports are checked first, so the usual case takes the port lock only once.
+        if (channel->is_logical_port_opened(logical_port))
         {
-            if (channel->is_logical_port_opened(logical_port))
+            TCPHeader tcp_header;
+            fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
+
+            asio::error_code ec;
+            size_t sent = channel->send(
+                (octet*)&tcp_header,
+                static_cast<uint32_t>(TCPHeader::size()),
+                send_buffer,
+                send_buffer_size,
+                ec);
+
+            if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
             {
-                TCPHeader tcp_header;
-                fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
-
-                {
-                    asio::error_code ec;
-                    size_t sent = channel->send(
-                        (octet*)&tcp_header,
-                        static_cast<uint32_t>(TCPHeader::size()),
-                        send_buffer,
-                        send_buffer_size,
-                        ec);
-
-                    if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
-                    {
-                        logWarning(DEBUG, "Failed to send RTCP message (" << sent << " of " <<
-                                TCPHeader::size() + send_buffer_size << " b): " << ec.message());
-                        success = false;
-                    }
-                    else
-                    {
-                        success = true;
-                    }
-                }
+                logWarning(DEBUG, "Failed to send RTCP message (" << sent << " of " <<
+                        TCPHeader::size() + send_buffer_size << " b): " << ec.message());
+                success = false;
+            }
+            else
+            {
+                success = true;
             }
         }
-        else
+        else if (!channel->is_logical_port_added(logical_port))
         {
             channel->add_logical_port(logical_port, rtcp_message_manager_.get());
         }
@@ -18,6 +18,11 @@
 #include <fastrtps/rtps/messages/MessageReceiver.h>
 #include <fastrtps/utils/eClock.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -28,7 +33,8 @@ UDPChannelResource::UDPChannelResource(
         uint32_t maxMsgSize,
         const Locator_t& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        uint32_t receive_batch_size)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
@@ -36,6 +42,20 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
+#if defined(__linux__)
+    if (receive_batch_size > 1)
+    {
+        batch_buffers_.reserve(receive_batch_size);
+        for (uint32_t i = 0; i < receive_batch_size; ++i)
+        {
+            batch_buffers_.emplace_back(maxMsgSize);
+        }
+        batch_remote_locators_.resize(receive_batch_size);
+    }
+#else
+    (void)receive_batch_size;
+#endif
+
     thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
 }
 
@@ -46,6 +66,12 @@ UDPChannelResource::~UDPChannelResource()
 
 void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
 {
+    if (!batch_buffers_.empty())
+    {
+        perform_batch_listen_operation(input_locator);
+        return;
+    }
+
     Locator_t remote_locator;
 
     while (alive())
@@ -71,6 +97,92 @@ void UDPChannelResource::perform_listen_operation(Locator_t input_locator)
     message_receiver(nullptr);
 }
 
+void UDPChannelResource::perform_batch_listen_operation(Locator_t input_locator)
+{
+#if defined(__linux__)
+    const size_t batch_size = batch_buffers_.size();
+
+    // Headers are allocated once for the whole life of the listening thread.
+    std::vector<mmsghdr> headers(batch_size);
+    std::vector<iovec> iovecs(batch_size);
+    std::vector<sockaddr_storage> addresses(batch_size);
+    asio::ip::udp::endpoint sender_endpoint;
+
+    while (alive())
+    {
+        for (size_t i = 0; i < batch_size; ++i)
+        {
+            iovecs[i].iov_base = batch_buffers_[i].buffer;
+            iovecs[i].iov_len = batch_buffers_[i].max_size;
+            memset(&headers[i], 0, sizeof(mmsghdr));
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+            headers[i].msg_hdr.msg_name = &addresses[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        }
+
+        // Blocks until one datagram arrives, then drains what is already queued without blocking again.
+        int received = recvmmsg(socket()->native_handle(), headers.data(), static_cast<unsigned int>(batch_size),
+                MSG_WAITFORONE, nullptr);
+        if (received <= 0)
+        {
+            if (received < 0 && errno != EINTR && alive())
+            {
+                logWarning(RTPS_MSG_IN, "Error receiving data: " << strerror(errno) << " - " << message_receiver()
+                    << " (" << this << ")");
+            }
+            continue;
+        }
+
+        // Valid datagrams are compacted at the beginning of the ring.
+        uint32_t count = 0;
+        for (int i = 0; i < received; ++i)
+        {
+            uint32_t length = static_cast<uint32_t>(headers[i].msg_len);
+            socklen_t address_length = headers[i].msg_hdr.msg_namelen;
+
+            // This is not necessary anymore but it's left here for back compatibility with versions older than 1.8.1
+            if (length == 0 || (length == 13 && memcmp(batch_buffers_[i].buffer, "EPRORTPSCLOSE", 13) == 0) ||
+                address_length > sender_endpoint.capacity())
+            {
+                continue;
+            }
+
+            memcpy(sender_endpoint.data(), &addresses[i], address_length);
+            sender_endpoint.resize(address_length);
+            transport_->endpoint_to_locator(sender_endpoint, batch_remote_locators_[count]);
+
+            if (count != static_cast<uint32_t>(i))
+            {
+                std::swap(batch_buffers_[count], batch_buffers_[i]);
+            }
+            batch_buffers_[count].length = length;
+            ++count;
+        }
+
+        if (count == 0)
+        {
+            continue;
+        }
+
+        // Processes the whole batch through the CDR Message interface.
+        if (message_receiver() != nullptr)
+        {
+            message_receiver()->OnDataBatchReceived(batch_buffers_.data(), batch_remote_locators_.data(), count,
+                input_locator);
+        }
+        else if (alive())
+        {
+            logWarning(RTPS_MSG_IN, "Received Message, but no receiver attached");
+        }
+    }
+
+    message_receiver(nullptr);
+#else
+    (void)input_locator;
+#endif
+}
+
 bool UDPChannelResource::Receive(
         octet* receive_buffer,
         uint32_t receive_buffer_capacity,
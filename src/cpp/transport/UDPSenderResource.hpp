@@ -47,6 +47,14 @@ class UDPSenderResource : public SenderResource
                 {
                     return transport.send(data, dataSize, socket_, destination, only_multicast_purpose_);
                 };
+
+            send_buffers_lambda_ = [this, &transport] (
+                    const NetworkBufferList& buffers,
+                    uint32_t total_bytes,
+                    const LocatorList_t& destinations)-> bool
+                {
+                    return transport.send(buffers, total_bytes, socket_, destinations, only_multicast_purpose_);
+                };
         }
 
         virtual ~UDPSenderResource()
@@ -24,6 +24,11 @@
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/utils/eClock.h>
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <cerrno>
+#endif
+
 using namespace std;
 using namespace asio;
 
@@ -52,6 +57,7 @@ UDPTransportDescriptor::UDPTransportDescriptor()
 UDPTransportDescriptor::UDPTransportDescriptor(const UDPTransportDescriptor& t)
     : SocketTransportDescriptor(t)
     , m_output_udp_socket(t.m_output_udp_socket)
+    , receive_batch_size(t.receive_batch_size)
 {
 }
 
@@ -214,7 +220,8 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
                                                              IPLocator::getPhysicalPort(locator), is_multicast);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
-                                                                    sInterface, receiver);
+                                                                    sInterface, receiver,
+                                                                    configuration()->receive_batch_size);
     return p_channel_resource;
 }
 
@@ -423,6 +430,140 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+bool UDPTransportInterface::send(
+        const NetworkBufferList& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        const LocatorList_t& remote_locators,
+        bool only_multicast_purpose)
+{
+    if (buffers.empty() || total_bytes > configuration()->sendBufferSize)
+    {
+        return false;
+    }
+
+    bool success = false;
+
+#if defined(__linux__)
+    // Gather lists and destinations are kept on the stack, so no allocation is done on this path.
+    static const size_t max_gather_buffers = 64;
+    static const size_t max_destinations = 64;
+
+    if (buffers.size() <= max_gather_buffers)
+    {
+        iovec iovecs[max_gather_buffers];
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            iovecs[i].iov_base = const_cast<octet*>(buffers[i].buffer);
+            iovecs[i].iov_len = buffers[i].size;
+        }
+
+        mmsghdr headers[max_destinations];
+        ip::udp::endpoint endpoints[max_destinations];
+        auto locator_it = remote_locators.begin();
+
+        while (locator_it != remote_locators.end())
+        {
+            unsigned int count = 0;
+            for (; locator_it != remote_locators.end() && count < max_destinations; ++locator_it)
+            {
+                const Locator_t& remote_locator = *locator_it;
+                if (!IsLocatorSupported(remote_locator) ||
+                    (only_multicast_purpose && !IPLocator::isMulticast(remote_locator)))
+                {
+                    continue;
+                }
+
+                endpoints[count] = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+                memset(&headers[count], 0, sizeof(mmsghdr));
+                headers[count].msg_hdr.msg_name = endpoints[count].data();
+                headers[count].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoints[count].size());
+                headers[count].msg_hdr.msg_iov = iovecs;
+                headers[count].msg_hdr.msg_iovlen = buffers.size();
+                ++count;
+            }
+
+            // The kernel may accept less messages than requested, so keep going until all are handled.
+            unsigned int sent = 0;
+            while (sent < count)
+            {
+                int ret = sendmmsg(getSocketPtr(socket)->native_handle(), &headers[sent], count - sent, 0);
+                if (ret < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    {
+                        logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                        success = true;
+                    }
+                    else
+                    {
+                        logWarning(RTPS_MSG_OUT, strerror(errno));
+                    }
+
+                    // Skip the destination that failed.
+                    ++sent;
+                    continue;
+                }
+
+                sent += static_cast<unsigned int>(ret);
+                success = true;
+            }
+
+            logInfo(RTPS_MSG_OUT, "UDPTransport: " << total_bytes << " bytes TO " << count << " endpoints FROM "
+                << getSocketPtr(socket)->local_endpoint());
+        }
+
+        return success;
+    }
+#endif
+
+    std::vector<asio::const_buffer> asio_buffers;
+    asio_buffers.reserve(buffers.size());
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        asio_buffers.emplace_back(buffer.buffer, buffer.size);
+    }
+
+    for (const Locator_t& remote_locator : remote_locators)
+    {
+        if (!IsLocatorSupported(remote_locator) ||
+            (only_multicast_purpose && !IPLocator::isMulticast(remote_locator)))
+        {
+            continue;
+        }
+
+        auto destinationEndpoint = generate_endpoint(remote_locator, IPLocator::getPhysicalPort(remote_locator));
+
+        asio::error_code ec;
+        getSocketPtr(socket)->send_to(asio_buffers, destinationEndpoint, 0, ec);
+        if (!!ec)
+        {
+            if ((ec.value() == asio::error::would_block) ||
+                (ec.value() == asio::error::try_again))
+            {
+                logWarning(RTPS_MSG_OUT, "UDP send would have blocked. Packet is dropped.");
+                success = true;
+            }
+            else
+            {
+                logWarning(RTPS_MSG_OUT, ec.message());
+            }
+            continue;
+        }
+
+        logInfo(RTPS_MSG_OUT, "UDPTransport: " << total_bytes << " bytes TO endpoint: " << destinationEndpoint
+            << " FROM " << getSocketPtr(socket)->local_endpoint());
+        success = true;
+    }
+
+    return success;
+}
+
 LocatorList_t UDPTransportInterface::ShrinkLocatorLists(const std::vector<LocatorList_t>& locatorLists)
 {
     LocatorList_t multicastResult, unicastResult;
@@ -43,6 +43,8 @@ XMLP_ret XMLParser::getXMLBuiltinAttributes(tinyxml2::XMLElement *elem, BuiltinA
                 <xs:element name="readerHistoryMemoryPolicy" type="historyMemoryPolicyType" minOccurs="0"/>
                 <xs:element name="writerHistoryMemoryPolicy" type="historyMemoryPolicyType" minOccurs="0"/>
                 <xs:element name="mutation_tries" type="uint32Type" minOccurs="0"/>
+                <xs:element name="discoveryProtocol" type="discoveryProtocolType" minOccurs="0"/>
+                <xs:element name="discoveryServersList" type="locatorListType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -183,6 +185,47 @@ XMLP_ret XMLParser::getXMLBuiltinAttributes(tinyxml2::XMLElement *elem, BuiltinA
             if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &builtin.mutation_tries, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, DISCOVERY_PROTOCOL) == 0)
+        {
+            /*
+                <xs:simpleType name="discoveryProtocolType">
+                    <xs:restriction base="xs:string">
+                        <xs:enumeration value="SIMPLE"/>
+                        <xs:enumeration value="CLIENT"/>
+                        <xs:enumeration value="SERVER"/>
+                    </xs:restriction>
+                </xs:simpleType>
+            */
+            const char* text = p_aux0->GetText();
+            if (nullptr == text)
+            {
+                logError(XMLPARSER, "Node '" << DISCOVERY_PROTOCOL << "' without content");
+                return XMLP_ret::XML_ERROR;
+            }
+            else if (strcmp(text, SIMPLE) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::SIMPLE;
+            }
+            else if (strcmp(text, CLIENT) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+            }
+            else if (strcmp(text, SERVER) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+            }
+            else
+            {
+                logError(XMLPARSER, "Node '" << DISCOVERY_PROTOCOL << "' with bad content");
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, DISCOVERY_SERVER_LIST) == 0)
+        {
+            // discoveryServersList
+            if (XMLP_ret::XML_OK != getXMLLocatorList(p_aux0, builtin.discoveryServerList, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'builtinAttributesType'. Name: " << name);
@@ -320,6 +363,8 @@ XMLP_ret XMLParser::getXMLThroughputController(tinyxml2::XMLElement *elem,
             <xs:all minOccurs="0">
                 <xs:element name="bytesPerPeriod" type="uint32Type" minOccurs="0"/>
                 <xs:element name="periodMillisecs" type="uint32Type" minOccurs="0"/>
+                <xs:element name="burstSize" type="uint32Type" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -341,6 +386,18 @@ XMLP_ret XMLParser::getXMLThroughputController(tinyxml2::XMLElement *elem,
             if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.periodMillisecs, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, BURST_SIZE) == 0)
+        {
+            // burstSize - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &throughputController.burstSize, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &throughputController.priority, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'portType'. Name: " << name);
@@ -1780,6 +1837,7 @@ XMLP_ret XMLParser::getXMLReaderTimes(tinyxml2::XMLElement *elem, ReaderTimes &t
             <xs:all minOccurs="0">
                 <xs:element name="initialAcknackDelay" type="durationType" minOccurs="0"/>
                 <xs:element name="heartbeatResponseDelay" type="durationType" minOccurs="0"/>
+                <xs:element name="acknackCoalescingWindow" type="durationType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -1801,6 +1859,12 @@ XMLP_ret XMLParser::getXMLReaderTimes(tinyxml2::XMLElement *elem, ReaderTimes &t
             if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.heartbeatResponseDelay, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, ACKNACK_COALESCING_WINDOW) == 0)
+        {
+            // acknackCoalescingWindow
+            if (XMLP_ret::XML_OK != getXMLDuration(p_aux0, times.acknackCoalescingWindow, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'readerTimesType'. Name: " << name);
@@ -2083,6 +2147,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
                 <xs:enumeration value="PREALLOCATED"/>
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
+                <xs:enumeration value="DYNAMIC_REUSABLE"/>
             </xs:restriction>
         </xs:simpleType>
     */
@@ -2098,6 +2163,8 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
         historyMemoryPolicy = MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
     else if (strcmp(text, DYNAMIC) == 0)
         historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE;
+    else if (strcmp(text, DYNAMIC_REUSABLE) == 0)
+        historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE;
     else
     {
         logError(XMLPARSER, "Node '" << KIND << "' bad content");
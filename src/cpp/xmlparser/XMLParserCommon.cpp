@@ -41,6 +41,7 @@ const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* RECEIVE_BATCH_SIZE = "receive_batch_size";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* MAX_MESSAGE_SIZE = "maxMessageSize";
 const char* MAX_INITIAL_PEERS_RANGE = "maxInitialPeersRange";
@@ -77,6 +78,9 @@ const char* PART_ID = "participantID";
 const char* THROUGHPUT_CONT = "throughputController";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
+const char* ASYNC_WRITER_THREADS = "asyncWriterThreads";
+const char* INTRAPROCESS_DELIVERY = "intraprocessDelivery";
+const char* HEARTBEAT_COALESCING_PERIOD = "heartbeatCoalescingPeriod";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
 const char* NAME = "name";
 
@@ -104,6 +108,7 @@ const char* PROPAGATE = "propagate";
 const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
+const char* DYNAMIC_REUSABLE = "DYNAMIC_REUSABLE";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -120,6 +125,7 @@ const char* TCPv4 = "TCPv4";
 const char* TCPv6 = "TCPv6";
 const char* INIT_ACKNACK_DELAY = "initialAcknackDelay";
 const char* HEARTB_RESP_DELAY = "heartbeatResponseDelay";
+const char* ACKNACK_COALESCING_WINDOW = "acknackCoalescingWindow";
 const char* INIT_HEARTB_DELAY = "initialHeartbeatDelay";
 const char* HEARTB_PERIOD = "heartbeatPeriod";
 const char* NACK_RESP_DELAY = "nackResponseDelay";
@@ -194,6 +200,8 @@ const char* DEPTH = "depth";
 const char* ALLOCATED_SAMPLES = "allocated_samples";
 const char* BYTES_PER_SECOND = "bytesPerPeriod";
 const char* PERIOD_MILLISECS = "periodMillisecs";
+const char* BURST_SIZE = "burstSize";
+const char* PRIORITY = "priority";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -219,6 +227,10 @@ const char* STATIC_ENDPOINT_XML = "staticEndpointXMLFilename";
 const char* READER_HIST_MEM_POLICY = "readerHistoryMemoryPolicy";
 const char* WRITER_HIST_MEM_POLICY = "writerHistoryMemoryPolicy";
 const char* MUTATION_TRIES = "mutation_tries";
+const char* DISCOVERY_PROTOCOL = "discoveryProtocol";
+const char* DISCOVERY_SERVER_LIST = "discoveryServersList";
+const char* CLIENT = "CLIENT";
+const char* SERVER = "SERVER";
 const char* ACCESS_SCOPE = "access_scope";
 const char* ENABLED = "enabled";
 
@@ -14,6 +14,7 @@
 
 #include "BlackboxTests.hpp"
 
+#include "PubSubParticipant.hpp"
 #include "PubSubWriterReader.hpp"
 #include "PubSubReader.hpp"
 #include "PubSubWriter.hpp"
@@ -351,6 +352,65 @@ TEST(BlackBox, LocalInitialPeers)
     reader.block_for_all();
 }
 
+// Clients only know the locator of the server, which introduces them only when they share a topic.
+TEST(BlackBox, DiscoveryServer)
+{
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, 127, 0, 0, 1);
+    server_locator.port = static_cast<uint16_t>(global_port);
+    LocatorList_t server_locators;
+    server_locators.push_back(server_locator);
+
+    PubSubParticipant<HelloWorldType> server(0u, 0u, 0u, 0u);
+    server.discovery_protocol(DiscoveryProtocol_t::SERVER).
+        metatraffic_unicast_locator_list(server_locators);
+    ASSERT_TRUE(server.init_participant());
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.discovery_protocol(DiscoveryProtocol_t::CLIENT).
+        discovery_server_list(server_locators).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.discovery_protocol(DiscoveryProtocol_t::CLIENT).
+        discovery_server_list(server_locators).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    PubSubReader<HelloWorldType> unrelated(TEST_TOPIC_NAME + "_unrelated");
+
+    unrelated.discovery_protocol(DiscoveryProtocol_t::CLIENT).
+        discovery_server_list(server_locators).init();
+
+    ASSERT_TRUE(unrelated.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    // Give the server some announcement periods to introduce the unrelated client by mistake.
+    std::this_thread::sleep_for(std::chrono::seconds(4));
+
+    // The reader knows the server and the writer, while the unrelated client only knows the server.
+    ASSERT_EQ(reader.get_participants_matched(), 2u);
+    ASSERT_EQ(unrelated.get_participants_matched(), 1u);
+    ASSERT_FALSE(unrelated.is_matched());
+}
+
 // Test created to check bug #2010 (Github #90)
 TEST(BlackBox, PubSubAsReliableHelloworldPartitions)
 {
@@ -284,6 +284,18 @@ public:
         liveliness_cv_.wait(lock, [&]() { return sub_times_liveliness_lost_ == num_lost;  });
     }
 
+    PubSubParticipant& discovery_protocol(eprosima::fastrtps::rtps::DiscoveryProtocol_t protocol)
+    {
+        participant_attr_.rtps.builtin.discoveryProtocol = protocol;
+        return *this;
+    }
+
+    PubSubParticipant& metatraffic_unicast_locator_list(eprosima::fastrtps::rtps::LocatorList_t unicastLocators)
+    {
+        participant_attr_.rtps.builtin.metatrafficUnicastLocatorList = unicastLocators;
+        return *this;
+    }
+
     PubSubParticipant& pub_topic_name(std::string topicName)
     {
         publisher_attr_.topic.topicDataType = type_.getName();
@@ -521,6 +521,12 @@ public:
         return *this;
     }
 
+    PubSubReader& acknack_coalescing_window(const eprosima::fastrtps::Duration_t& window)
+    {
+        subscriber_attr_.times.acknackCoalescingWindow = window;
+        return *this;
+    }
+
     PubSubReader& unicastLocatorList(eprosima::fastrtps::rtps::LocatorList_t unicastLocators)
     {
         subscriber_attr_.unicastLocatorList = unicastLocators;
@@ -597,6 +603,18 @@ public:
         return *this;
     }
 
+    PubSubReader& discovery_protocol(eprosima::fastrtps::rtps::DiscoveryProtocol_t protocol)
+    {
+        participant_attr_.rtps.builtin.discoveryProtocol = protocol;
+        return *this;
+    }
+
+    PubSubReader& discovery_server_list(eprosima::fastrtps::rtps::LocatorList_t servers)
+    {
+        participant_attr_.rtps.builtin.discoveryServerList = servers;
+        return *this;
+    }
+
     PubSubReader& static_discovery(const char* filename)
     {
         participant_attr_.rtps.builtin.use_SIMPLE_EndpointDiscoveryProtocol = false;
@@ -802,6 +820,12 @@ public:
         return matched_ > 0;
     }
 
+    unsigned int get_participants_matched()
+    {
+        std::unique_lock<std::mutex> lock(mutexDiscovery_);
+        return participant_matched_;
+    }
+
 private:
 
     const eprosima::fastrtps::rtps::GUID_t& participant_guid() const
@@ -553,6 +553,12 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& heartbeat_coalescing_period(const eprosima::fastrtps::Duration_t& period)
+    {
+        participant_attr_.rtps.heartbeatCoalescingPeriod = period;
+        return *this;
+    }
+
     PubSubWriter& unicastLocatorList(eprosima::fastrtps::rtps::LocatorList_t unicastLocators)
     {
         publisher_attr_.unicastLocatorList = unicastLocators;
@@ -623,6 +629,18 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& discovery_protocol(eprosima::fastrtps::rtps::DiscoveryProtocol_t protocol)
+    {
+        participant_attr_.rtps.builtin.discoveryProtocol = protocol;
+        return *this;
+    }
+
+    PubSubWriter& discovery_server_list(eprosima::fastrtps::rtps::LocatorList_t servers)
+    {
+        participant_attr_.rtps.builtin.discoveryServerList = servers;
+        return *this;
+    }
+
     PubSubWriter& static_discovery(const char* filename)
     {
         participant_attr_.rtps.builtin.use_SIMPLE_EndpointDiscoveryProtocol = false;
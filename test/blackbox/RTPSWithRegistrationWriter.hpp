@@ -74,7 +74,7 @@ class RTPSWithRegistrationWriter
     public:
 
     RTPSWithRegistrationWriter(const std::string& topic_name) : listener_(*this), participant_(nullptr),
-    writer_(nullptr), history_(nullptr), initialized_(false), matched_(0)
+    writer_(nullptr), history_(nullptr), initialized_(false), matched_(0), intraprocess_delivery_(false)
     {
         topic_attr_.topicDataType = type_.getName();
         // Generate topic name
@@ -104,6 +104,7 @@ class RTPSWithRegistrationWriter
         pattr.builtin.use_SIMPLE_RTPSParticipantDiscoveryProtocol = true;
         pattr.builtin.use_WriterLivelinessProtocol = true;
         pattr.builtin.domainId = (uint32_t)GET_PID() % 230;
+        pattr.intraprocessDelivery = intraprocess_delivery_;
         participant_ = eprosima::fastrtps::rtps::RTPSDomain::createParticipant(pattr);
         ASSERT_NE(participant_, nullptr);
 
@@ -232,6 +233,12 @@ class RTPSWithRegistrationWriter
         return *this;
     }
 
+    RTPSWithRegistrationWriter& intraprocess_delivery(bool enabled)
+    {
+        intraprocess_delivery_ = enabled;
+        return *this;
+    }
+
     RTPSWithRegistrationWriter& add_property(const std::string& prop, const std::string& value)
     {
         writer_attr_.endpoint.properties.properties().emplace_back(prop, value);
@@ -265,6 +272,7 @@ class RTPSWithRegistrationWriter
         std::mutex mutex_;
         std::condition_variable cv_;
         unsigned int matched_;
+        bool intraprocess_delivery_;
         type_support type_;
 };
 
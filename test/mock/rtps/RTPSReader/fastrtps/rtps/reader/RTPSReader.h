@@ -55,6 +55,10 @@ class RTPSReader : public Endpoint
 
         MOCK_CONST_METHOD0(getGuid, const GUID_t&());
 
+        MOCK_METHOD2(reserveCache, bool(CacheChange_t** change, uint32_t dataCdrSerializedSize));
+
+        MOCK_METHOD1(releaseCache, void(CacheChange_t* change));
+
         ReaderHistory* getHistory()
         {
             getHistory_mock();
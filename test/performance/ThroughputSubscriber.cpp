@@ -30,6 +30,7 @@
 #include <fastrtps/subscriber/SampleInfo.h>
 
 #include <fastrtps/Domain.h>
+#include <fastrtps/transport/UDPv4TransportDescriptor.h>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -311,7 +312,7 @@ ThroughputSubscriber::~ThroughputSubscriber()
 ThroughputSubscriber::ThroughputSubscriber(bool reliable, uint32_t pid, bool hostname,
     const eprosima::fastrtps::rtps::PropertyPolicy& part_property_policy,
     const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
-    const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain)
+    const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain, uint32_t receive_batch_size)
     : disc_count_(0)
     , data_disc_count_(0)
     , stop_count_(0)
@@ -325,6 +326,7 @@ ThroughputSubscriber::ThroughputSubscriber(bool reliable, uint32_t pid, bool hos
     , m_sXMLConfigFile(sXMLConfigFile)
     , dynamic_data(dynamic_types)
     , m_forced_domain(forced_domain)
+    , m_receive_batch_size(receive_batch_size)
     , throughputin(nullptr)
 {
     if (dynamic_data) // Dummy type registration
@@ -358,6 +360,16 @@ ThroughputSubscriber::ThroughputSubscriber(bool reliable, uint32_t pid, bool hos
     PParam.rtps.setName("Participant_subscriber");
     PParam.rtps.properties = part_property_policy;
 
+    if (m_receive_batch_size > 1)
+    {
+        // Batched receive is configured through a user UDPv4 transport.
+        auto udp_transport = std::make_shared<UDPv4TransportDescriptor>();
+        udp_transport->receive_batch_size = m_receive_batch_size;
+        PParam.rtps.useBuiltinTransports = false;
+        PParam.rtps.userTransports.push_back(udp_transport);
+        std::cout << "Receiving up to " << m_receive_batch_size << " datagrams per system call" << std::endl;
+    }
+
     if (m_sXMLConfigFile.length() > 0)
     {
         if (m_forced_domain >= 0)
@@ -55,7 +55,8 @@ public:
     ThroughputSubscriber(bool reliable, uint32_t pid, bool hostname,
         const eprosima::fastrtps::rtps::PropertyPolicy& part_property_policy,
         const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
-        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain);
+        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain,
+        uint32_t receive_batch_size = 1);
     virtual ~ThroughputSubscriber();
     void processMessage();
     eprosima::fastrtps::Participant* mp_par;
@@ -133,6 +134,7 @@ public:
     std::string m_sXMLConfigFile;
     bool dynamic_data = false;
     int m_forced_domain;
+    uint32_t m_receive_batch_size;
 
     // Static Data
     ThroughputDataType* throughput_t;
@@ -0,0 +1,330 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_ReceiveScalingTest.cpp
+ *
+ * Measures how reception scales with the number of input sockets of a participant.
+ * For each number of sockets N, a subscribing participant creates N readers, each one listening on its own
+ * unicast port, and a publishing participant feeds each of them from its own thread.
+ */
+
+#include "ThroughputTypes.h"
+
+#include "optionparser.h"
+
+#include <fastrtps/Domain.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/attributes/PublisherAttributes.h>
+#include <fastrtps/attributes/SubscriberAttributes.h>
+#include <fastrtps/publisher/Publisher.h>
+#include <fastrtps/publisher/PublisherListener.h>
+#include <fastrtps/subscriber/Subscriber.h>
+#include <fastrtps/subscriber/SubscriberListener.h>
+#include <fastrtps/subscriber/SampleInfo.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct Arg : public option::Arg
+{
+    static option::ArgStatus Numeric(const option::Option& option, bool msg)
+    {
+        char* endptr = 0;
+        if (option.arg != 0 && strtol(option.arg, &endptr, 10))
+        {
+        };
+        if (endptr != option.arg && *endptr == 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            fprintf(stderr, "Option '%.*s' requires a numeric argument\n", option.namelen, option.name);
+        }
+        return option::ARG_ILLEGAL;
+    }
+};
+
+enum  optionIndex {
+    UNKNOWN_OPT,
+    HELP,
+    SOCKETS,
+    TIME,
+    MSG_SIZE,
+    BASE_PORT,
+    FORCED_DOMAIN
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0,"", "",                Arg::None,
+        "Usage: ReceiveScalingTest [options]\n\nGeneral options:" },
+    { HELP,    0,"h", "help",               Arg::None,      "  -h \t--help  \tProduce help message." },
+    { SOCKETS, 0,"s", "sockets",            Arg::Numeric,   "  -s <num>, \t--sockets=<num>  \tMaximum number of input sockets (Default: 4)." },
+    { TIME,    0,"t", "time",               Arg::Numeric,   "  -t <num>, \t--time=<num>  \tSeconds each round lasts (Default: 5)." },
+    { MSG_SIZE,0,"", "msg_size",            Arg::Numeric,   "  \t--msg_size=<num>  \tPayload size in bytes (Default: 64)." },
+    { BASE_PORT,0,"", "base_port",          Arg::Numeric,   "  \t--base_port=<num>  \tFirst port used by the readers (Default: 21000)." },
+    { FORCED_DOMAIN,0,"", "domain",         Arg::Numeric,   "  \t--domain=<num>  \tRTPS Domain (Default: 0)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+class CountingListener : public SubscriberListener
+{
+public:
+
+    CountingListener(uint32_t msg_size)
+        : received(0)
+        , matched(0)
+        , data_(msg_size)
+    {
+    }
+
+    void onNewDataMessage(Subscriber* sub) override
+    {
+        SampleInfo_t info;
+        while (sub->takeNextData(&data_, &info))
+        {
+            if (info.sampleKind == ALIVE)
+            {
+                received.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void onSubscriptionMatched(Subscriber* /*sub*/, MatchingInfo& info) override
+    {
+        if (info.status == MATCHED_MATCHING)
+        {
+            ++matched;
+        }
+    }
+
+    std::atomic<uint64_t> received;
+    std::atomic<uint32_t> matched;
+
+private:
+
+    ThroughputType data_;
+};
+
+class MatchingListener : public PublisherListener
+{
+public:
+
+    MatchingListener() : matched(0) {}
+
+    void onPublicationMatched(Publisher* /*pub*/, MatchingInfo& info) override
+    {
+        if (info.status == MATCHED_MATCHING)
+        {
+            ++matched;
+        }
+    }
+
+    std::atomic<uint32_t> matched;
+};
+
+static bool run_round(uint32_t sockets, uint32_t seconds, uint32_t msg_size, uint32_t base_port, uint32_t domain,
+        uint64_t& received)
+{
+    ParticipantAttributes PParam;
+    PParam.rtps.builtin.domainId = domain;
+    PParam.rtps.setName("receive_scaling_subscriber");
+    Participant* sub_participant = Domain::createParticipant(PParam);
+    PParam.rtps.setName("receive_scaling_publisher");
+    Participant* pub_participant = Domain::createParticipant(PParam);
+    if (sub_participant == nullptr || pub_participant == nullptr)
+    {
+        return false;
+    }
+
+    ThroughputDataType sub_type(msg_size);
+    ThroughputDataType pub_type(msg_size);
+    Domain::registerType(sub_participant, &sub_type);
+    Domain::registerType(pub_participant, &pub_type);
+
+    std::vector<std::unique_ptr<CountingListener>> sub_listeners;
+    std::vector<std::unique_ptr<MatchingListener>> pub_listeners;
+    std::vector<Publisher*> publishers;
+
+    for (uint32_t i = 0; i < sockets; ++i)
+    {
+        std::ostringstream topic;
+        topic << "ReceiveScaling_" << i;
+
+        // Each reader listens on its own port, so it gets its own input socket and listening thread.
+        SubscriberAttributes Rparam;
+        Rparam.topic.topicDataType = sub_type.getName();
+        Rparam.topic.topicName = topic.str();
+        Rparam.topic.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+        Rparam.topic.historyQos.depth = 100;
+        Rparam.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        locator.port = base_port + i;
+        Rparam.unicastLocatorList.push_back(locator);
+        sub_listeners.emplace_back(new CountingListener(msg_size));
+        if (Domain::createSubscriber(sub_participant, Rparam, sub_listeners.back().get()) == nullptr)
+        {
+            return false;
+        }
+
+        PublisherAttributes Wparam;
+        Wparam.topic.topicDataType = pub_type.getName();
+        Wparam.topic.topicName = topic.str();
+        Wparam.topic.historyQos.kind = KEEP_LAST_HISTORY_QOS;
+        Wparam.topic.historyQos.depth = 1;
+        Wparam.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+        pub_listeners.emplace_back(new MatchingListener());
+        Publisher* publisher = Domain::createPublisher(pub_participant, Wparam, pub_listeners.back().get());
+        if (publisher == nullptr)
+        {
+            return false;
+        }
+        publishers.push_back(publisher);
+    }
+
+    // Wait for all the pairs to match.
+    auto match_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (uint32_t i = 0; i < sockets; ++i)
+    {
+        while (sub_listeners[i]->matched == 0 || pub_listeners[i]->matched == 0)
+        {
+            if (std::chrono::steady_clock::now() > match_deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    std::atomic<bool> running(true);
+    std::vector<std::thread> writers;
+    for (uint32_t i = 0; i < sockets; ++i)
+    {
+        Publisher* publisher = publishers[i];
+        writers.emplace_back([publisher, msg_size, &running]()
+                {
+                    ThroughputType sample(static_cast<uint16_t>(msg_size));
+                    while (running)
+                    {
+                        ++sample.seqnum;
+                        publisher->write(&sample);
+                    }
+                });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    running = false;
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+
+    received = 0;
+    for (auto& listener : sub_listeners)
+    {
+        received += listener->received;
+    }
+
+    Domain::removeParticipant(pub_participant);
+    Domain::removeParticipant(sub_participant);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t max_sockets = 4;
+    uint32_t seconds = 5;
+    uint32_t msg_size = 64;
+    uint32_t base_port = 21000;
+    uint32_t domain = 0;
+
+    argc -= (argc > 0);
+    argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(true, usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(true, usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, 80);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case SOCKETS:
+                max_sockets = strtol(opt.arg, nullptr, 10);
+                break;
+            case TIME:
+                seconds = strtol(opt.arg, nullptr, 10);
+                break;
+            case MSG_SIZE:
+                msg_size = strtol(opt.arg, nullptr, 10);
+                break;
+            case BASE_PORT:
+                base_port = strtol(opt.arg, nullptr, 10);
+                break;
+            case FORCED_DOMAIN:
+                domain = strtol(opt.arg, nullptr, 10);
+                break;
+            default:
+                break;
+        }
+    }
+
+    printf("[ Sockets][ Rec Samples][  Packs/sec][ Packs/sec/socket]\n");
+    printf("[--------][------------][-----------][-----------------]\n");
+
+    for (uint32_t sockets = 1; sockets <= max_sockets; ++sockets)
+    {
+        uint64_t received = 0;
+        if (!run_round(sockets, seconds, msg_size, base_port, domain, received))
+        {
+            printf("Round with %u sockets failed\n", sockets);
+            Domain::stopAll();
+            return 1;
+        }
+
+        double packs_sec = static_cast<double>(received) / seconds;
+        printf("%10u,%13.0f,%12.0f,%18.0f\n", sockets, static_cast<double>(received), packs_sec,
+                packs_sec / sockets);
+    }
+
+    Domain::stopAll();
+    return 0;
+}
@@ -133,7 +133,8 @@ enum  optionIndex {
     CERTS_PATH,
     XML_FILE,
     DYNAMIC_TYPES,
-    FORCED_DOMAIN
+    FORCED_DOMAIN,
+    RECV_BATCH
 };
 
 const option::Descriptor usage[] = {
@@ -149,6 +150,8 @@ const option::Descriptor usage[] = {
     { USE_SECURITY, 0, "", "security",      Arg::Required,  "  --security <arg>  \tEcho mode (\"true\"/\"false\")." },
     { CERTS_PATH, 0, "", "certs",           Arg::Required,  "  --certs <arg>  \tPath where located certificates." },
 #endif
+    { UNKNOWN_OPT, 0,"", "",                Arg::None,      "\nSubscriber options:"},
+    { RECV_BATCH, 0, "", "recv_batch",      Arg::Numeric,   "  \t--recv_batch=<num>  \tMaximum number of datagrams received per system call." },
     { UNKNOWN_OPT, 0,"", "",                Arg::None,      "\nPublisher options:"},
     { TIME, 0,"t","time",                   Arg::Numeric,   "  -t <num>, \t--time=<num>  \tTime of the test in seconds." },
     { RECOVERY_TIME, 0,"","recovery_time",  Arg::Numeric,   "  \t--recovery_time=<num>  \tHow long to sleep after writing a demand in milliseconds." },
@@ -195,6 +198,7 @@ int main(int argc, char** argv)
     std::string sXMLConfigFile = "";
     bool dynamic_types = false;
     int forced_domain = -1;
+    uint32_t recv_batch = 1;
 #if HAVE_SECURITY
     bool use_security = false;
     std::string certs_path;
@@ -328,6 +332,10 @@ int main(int argc, char** argv)
                 forced_domain = strtol(opt.arg, nullptr, 10);
                 break;
 
+            case RECV_BATCH:
+                recv_batch = strtol(opt.arg, nullptr, 10);
+                break;
+
 #if HAVE_SECURITY
             case USE_SECURITY:
                 if (strcmp(opt.arg, "true") == 0)
@@ -416,7 +424,8 @@ int main(int argc, char** argv)
     }
     else
     {
-        ThroughputSubscriber tsub(reliable, seed, hostname, sub_part_property_policy, sub_property_policy, sXMLConfigFile, dynamic_types, forced_domain);
+        ThroughputSubscriber tsub(reliable, seed, hostname, sub_part_property_policy, sub_property_policy, sXMLConfigFile,
+            dynamic_types, forced_domain, recv_batch);
         tsub.run();
     }
 
@@ -37,6 +37,14 @@ publisher_proc = subprocess.Popen([command, "publisher", "--file", payload_deman
 subscriber_proc.communicate()
 publisher_proc.communicate()
 
+# Best effort execution with batched receive, to compare against the plain one
+subscriber_proc = subprocess.Popen([command, "subscriber", "--hostname", "--recv_batch=32"] + security_options)
+publisher_proc = subprocess.Popen([command, "publisher", "--file", payload_demands, "--hostname", "--export_csv",
+    "--export_prefix=recv_batch_"] + security_options)
+
+subscriber_proc.communicate()
+publisher_proc.communicate()
+
 # Reliable execution
 subscriber_proc = subprocess.Popen([command, "subscriber", "-r", "reliable", "--hostname"] + security_options)
 publisher_proc = subprocess.Popen([command, "publisher", "-r", "reliable", "--file", payload_demands, "--hostname",
@@ -66,7 +66,8 @@ int main(int argc, char** argv)
             << "        tl_be: transient-local best-effort" << std::endl
             << "        tl_re: transient-local reliable" << std::endl
             << "        vo_be: volatile best-effort" << std::endl
-            << "        vo_re: volatile reliable" << std::endl;
+            << "        vo_re: volatile reliable" << std::endl
+            << "        vo_re_reuse: volatile reliable, reusing dynamic history memory" << std::endl;
         Log::Reset();
         return 0;
     }
@@ -141,6 +141,113 @@ TEST_F(ThroughputControllerTests, throughput_controller_resets_completely_after_
    std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
 }
 
+TEST_F(ThroughputControllerTests, throughput_controller_lets_a_burst_through_after_being_idle)
+{
+   // Given a controller whose bucket holds all the changes
+   ThroughputControllerDescriptor descriptor = testDescriptor;
+   descriptor.burstSize = numberOfTestChanges * testPayloadSize;
+   ThroughputController controller(descriptor, (const RTPSWriter*)nullptr);
+
+   // When
+   controller(testChangesForUse);
+
+   // Then
+   ASSERT_EQ(numberOfTestChanges, testChangesForUse.size());
+
+   // The bucket is now empty, and refills at the same rate as before
+   controller(otherChangesForUse);
+   ASSERT_EQ(0u, otherChangesForUse.size());
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(ThroughputControllerTests, throughput_controller_holds_back_lower_priority_writers)
+{
+   // Given a high priority writer waiting for the controller
+   testChangesForUse.priority(1);
+   sController(testChangesForUse);
+   ASSERT_EQ(5u, testChangesForUse.size());
+
+   // When
+   // A lower priority writer tries to send something that would fit in the remaining bytes
+   RTPSWriterCollector<ReaderLocator*> smallChanges;
+   otherChanges.front()->serializedPayload.length = 100;
+   smallChanges.add_change(otherChanges.front().get(), &mock, FragmentNumberSet_t());
+   sController(smallChanges);
+
+   // Then
+   ASSERT_EQ(0u, smallChanges.size());
+
+   // Once the bucket is refilled, the high priority writer is served, and then the rest
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+   RTPSWriterCollector<ReaderLocator*> highChanges;
+   highChanges.priority(1);
+   highChanges.add_change(testChanges.front().get(), &mock, FragmentNumberSet_t());
+   sController(highChanges);
+   ASSERT_EQ(1u, highChanges.size());
+
+   smallChanges.add_change(otherChanges.front().get(), &mock, FragmentNumberSet_t());
+   sController(smallChanges);
+   EXPECT_EQ(1u, smallChanges.size());
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(ThroughputControllerTests, throughput_controller_never_exceeds_bytes_per_period_under_sustained_load)
+{
+   // Given changes offered much faster than the controller clears them
+   const uint32_t smallPayloadSize = 500;
+   const std::chrono::milliseconds period(periodMillisecs);
+   const std::chrono::milliseconds offerInterval(5);
+   // Times are taken before calling the controller, so the checked windows are slightly shorter than a period
+   const std::chrono::milliseconds tolerance(10);
+
+   std::vector<std::pair<std::chrono::steady_clock::time_point, uint32_t>> cleared;
+   uint32_t totalBytes = 0;
+
+   // When
+   auto start = std::chrono::steady_clock::now();
+   while (std::chrono::steady_clock::now() - start < 5 * period)
+   {
+      std::vector<std::unique_ptr<CacheChange_t>> changes;
+      RTPSWriterCollector<ReaderLocator*> offeredChanges;
+      for (unsigned int i = 0; i < numberOfTestChanges; i++)
+      {
+         changes.emplace_back(new CacheChange_t(smallPayloadSize));
+         changes.back()->sequenceNumber = {0, i+1};
+         changes.back()->serializedPayload.length = smallPayloadSize;
+         offeredChanges.add_change(changes.back().get(), &mock, FragmentNumberSet_t());
+      }
+
+      auto offeredAt = std::chrono::steady_clock::now();
+      sController(offeredChanges);
+
+      uint32_t clearedBytes = static_cast<uint32_t>(offeredChanges.size()) * smallPayloadSize;
+      if (clearedBytes > 0)
+      {
+         cleared.emplace_back(offeredAt, clearedBytes);
+         totalBytes += clearedBytes;
+      }
+
+      std::this_thread::sleep_for(offerInterval);
+   }
+
+   // Then
+   for (size_t first = 0; first < cleared.size(); first++)
+   {
+      uint32_t bytesInWindow = 0;
+      for (size_t last = first;
+            last < cleared.size() && cleared[last].first - cleared[first].first < period - tolerance;
+            last++)
+      {
+         bytesInWindow += cleared[last].second;
+      }
+      ASSERT_LE(bytesInWindow, controllerSize);
+   }
+
+   // The controller kept clearing changes during the whole test
+   EXPECT_GE(totalBytes, 3 * controllerSize);
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -121,6 +121,10 @@ TEST_P(CacheChangePoolTests, reserve_cache)
             case MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE:
                 ASSERT_EQ(ch->serializedPayload.max_size, data_size);
                 break;
+            case MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE:
+                ASSERT_GE(ch->serializedPayload.max_size, data_size);
+                ASSERT_LT(ch->serializedPayload.max_size, max(1U, data_size * 2));
+                break;
         }
 
         if (max_size > 0)
@@ -245,7 +249,97 @@ INSTANTIATE_TEST_CASE_P(
             Values(128, 256, 512, 1024),
             Values(MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE,
                    MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE,
-                   MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE)), );
+                   MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE,
+                   MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)), );
+
+TEST(CacheChangePoolReusableTests, reuse_changes_and_payloads)
+{
+    CacheChangePool pool(10, 128, 0, MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE);
+
+    CacheChange_t* ch = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 100U));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ch) % 64U, 0U);
+    ASSERT_EQ(ch->serializedPayload.max_size, 128U);
+    octet* data = ch->serializedPayload.data;
+
+    // A payload of the same size class gets the same buffer
+    pool.release_Cache(ch);
+    ASSERT_EQ(ch->serializedPayload.data, nullptr);
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 120U));
+    ASSERT_EQ(ch->serializedPayload.data, data);
+    ASSERT_EQ(ch->serializedPayload.max_size, 128U);
+
+    // A bigger payload does not take it
+    CacheChange_t* ch2 = nullptr;
+    pool.release_Cache(ch);
+    ASSERT_TRUE(pool.reserve_Cache(&ch2, 200U));
+    ASSERT_NE(ch2->serializedPayload.data, data);
+    ASSERT_EQ(ch2->serializedPayload.max_size, 256U);
+
+    // Buffers are classified by their size when released, wherever they come from
+    octet* data2 = ch2->serializedPayload.data;
+    pool.release_Cache(ch2);
+    ASSERT_TRUE(pool.reserve_Cache(&ch, 256U));
+    ASSERT_EQ(ch->serializedPayload.data, data2);
+    ASSERT_TRUE(pool.reserve_Cache(&ch2, 128U));
+    ASSERT_EQ(ch2->serializedPayload.data, data);
+
+    // Empty payloads get no buffer
+    CacheChange_t* ch3 = nullptr;
+    ASSERT_TRUE(pool.reserve_Cache(&ch3, 0U));
+    ASSERT_EQ(ch3->serializedPayload.data, nullptr);
+
+    pool.release_Cache(ch);
+    pool.release_Cache(ch2);
+    pool.release_Cache(ch3);
+    ASSERT_EQ(pool.get_freeCachesSize(), pool.get_allCachesSize());
+}
+
+TEST(CacheChangePoolSharedPayloadTests, share_payload_between_pools)
+{
+    CacheChangePool pool_1(10, 128, 0, MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE);
+    CacheChangePool pool_2(10, 128, 0, MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE);
+
+    CacheChange_t source;
+    source.sequenceNumber.low = 5;
+    source.serializedPayload.reserve(64);
+    source.serializedPayload.length = 64;
+    memset(source.serializedPayload.data, 0xAB, 64);
+    octet* source_data = source.serializedPayload.data;
+
+    ASSERT_TRUE(source.make_shared_payload());
+    ASSERT_TRUE(source.has_shared_payload());
+    ASSERT_NE(source.serializedPayload.data, source_data);
+    ASSERT_EQ(source.serializedPayload.length, 64U);
+
+    CacheChange_t* ch_1 = nullptr;
+    CacheChange_t* ch_2 = nullptr;
+    ASSERT_TRUE(pool_1.reserve_Cache(&ch_1, 0U));
+    ASSERT_TRUE(pool_2.reserve_Cache(&ch_2, 0U));
+    octet* own_data = ch_1->serializedPayload.data;
+    ch_1->copy_shared(&source);
+    ch_2->copy_shared(&source);
+
+    // Both changes reference the same data
+    ASSERT_EQ(ch_1->sequenceNumber, source.sequenceNumber);
+    ASSERT_EQ(ch_1->serializedPayload.data, source.serializedPayload.data);
+    ASSERT_EQ(ch_2->serializedPayload.data, source.serializedPayload.data);
+    ASSERT_EQ(ch_2->serializedPayload.length, 64U);
+
+    // The source gets its own buffer back, and the shared data outlives it
+    source.release_shared_payload();
+    ASSERT_EQ(source.serializedPayload.data, source_data);
+    ASSERT_EQ(ch_1->serializedPayload.data[63], 0xAB);
+
+    // Changes get their own buffers back when released to the pool
+    pool_1.release_Cache(ch_1);
+    ASSERT_FALSE(ch_1->has_shared_payload());
+    ASSERT_EQ(ch_1->serializedPayload.data, own_data);
+    ASSERT_EQ(ch_1->serializedPayload.max_size, 128U);
+    ASSERT_EQ(ch_2->serializedPayload.data[0], 0xAB);
+    pool_2.release_Cache(ch_2);
+    ASSERT_EQ(ch_2->serializedPayload.data, nullptr);
+}
 
 int main(int argc, char **argv)
 {
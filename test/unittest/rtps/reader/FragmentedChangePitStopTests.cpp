@@ -0,0 +1,152 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastrtps/rtps/reader/StatefulReader.h>
+#include <rtps/reader/FragmentedChangePitStop.h>
+
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::_;
+using ::testing::Invoke;
+
+static const uint16_t fragmentSize = 100;
+static const uint32_t sampleSize = 350;
+
+class FragmentedChangePitStopTests : public ::testing::Test
+{
+    public:
+
+        FragmentedChangePitStopTests()
+            : pit(&reader)
+        {
+            for (uint32_t i = 0; i < sampleSize; ++i)
+            {
+                sample.push_back(static_cast<octet>(i));
+            }
+
+            writer_a.guidPrefix.value[0] = 1;
+            writer_b.guidPrefix.value[0] = 2;
+
+            ON_CALL(reader, reserveCache(_, _)).WillByDefault(Invoke([this](CacheChange_t** change, uint32_t size)
+                    {
+                        reserved.emplace_back(new CacheChange_t(size));
+                        *change = reserved.back().get();
+                        return true;
+                    }));
+        }
+
+        ~FragmentedChangePitStopTests()
+        {
+            // Incoming changes point to the sample, as received changes point to the reception buffer.
+            for (auto& change : incoming)
+            {
+                change->serializedPayload.data = nullptr;
+            }
+        }
+
+        //! Builds a DATA_FRAG like change carrying the fragments [first, first + count) of the sample.
+        CacheChange_t* data_frag(const GUID_t& writer, uint32_t first, uint32_t count)
+        {
+            incoming.emplace_back(new CacheChange_t());
+            CacheChange_t* change = incoming.back().get();
+            change->writerGUID = writer;
+            change->sequenceNumber = SequenceNumber_t(0, 1);
+            change->serializedPayload.data = sample.data() + (first - 1) * fragmentSize;
+            change->serializedPayload.length = std::min(count * fragmentSize, sampleSize - (first - 1) * fragmentSize);
+            change->setFragmentSize(fragmentSize);
+            return change;
+        }
+
+        StatefulReader reader;
+        FragmentedChangePitStop pit;
+        GUID_t writer_a;
+        GUID_t writer_b;
+        std::vector<octet> sample;
+        std::vector<std::unique_ptr<CacheChange_t>> reserved;
+        std::vector<std::unique_ptr<CacheChange_t>> incoming;
+};
+
+TEST_F(FragmentedChangePitStopTests, change_is_completed_when_all_fragments_arrive)
+{
+    EXPECT_CALL(reader, reserveCache(_, sampleSize)).Times(2);
+
+    // Fragments of two writers with the same sequence number, out of order and repeated.
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 3, 2), sampleSize, 3));
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_b, 1, 2), sampleSize, 1));
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 3, 1), sampleSize, 3));
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 1, 1), sampleSize, 1));
+
+    CacheChange_t* change_a = pit.find(SequenceNumber_t(0, 1), writer_a);
+    CacheChange_t* change_b = pit.find(SequenceNumber_t(0, 1), writer_b);
+    ASSERT_NE(nullptr, change_a);
+    ASSERT_NE(nullptr, change_b);
+    ASSERT_NE(change_a, change_b);
+
+    // The last fragment of writer A completes its sample.
+    ASSERT_EQ(change_a, pit.process(data_frag(writer_a, 2, 1), sampleSize, 2));
+    ASSERT_EQ(nullptr, pit.find(SequenceNumber_t(0, 1), writer_a));
+    ASSERT_EQ(change_b, pit.find(SequenceNumber_t(0, 1), writer_b));
+
+    ASSERT_EQ(sampleSize, change_a->serializedPayload.length);
+    ASSERT_EQ(0, memcmp(sample.data(), change_a->serializedPayload.data, sampleSize));
+}
+
+TEST_F(FragmentedChangePitStopTests, fragments_out_of_the_sample_are_ignored)
+{
+    EXPECT_CALL(reader, reserveCache(_, sampleSize)).Times(1);
+
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 4, 1), sampleSize, 4));
+
+    // Claims to carry fragments 4 to 6, but the sample only has 4.
+    CacheChange_t* overflowing = data_frag(writer_a, 1, 3);
+    ASSERT_EQ(nullptr, pit.process(overflowing, sampleSize, 4));
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 1, 3), sampleSize, 0));
+
+    ASSERT_NE(nullptr, pit.process(data_frag(writer_a, 1, 3), sampleSize, 1));
+}
+
+TEST_F(FragmentedChangePitStopTests, changes_are_removed)
+{
+    EXPECT_CALL(reader, reserveCache(_, sampleSize)).Times(3);
+    EXPECT_CALL(reader, releaseCache(_)).Times(3);
+
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_a, 1, 1), sampleSize, 1));
+    ASSERT_EQ(nullptr, pit.process(data_frag(writer_b, 1, 1), sampleSize, 1));
+    CacheChange_t* second = data_frag(writer_a, 1, 1);
+    second->sequenceNumber = SequenceNumber_t(0, 2);
+    ASSERT_EQ(nullptr, pit.process(second, sampleSize, 1));
+
+    ASSERT_FALSE(pit.try_to_remove(SequenceNumber_t(0, 3), writer_a));
+    ASSERT_TRUE(pit.try_to_remove(SequenceNumber_t(0, 1), writer_b));
+    ASSERT_FALSE(pit.try_to_remove(SequenceNumber_t(0, 1), writer_b));
+
+    // Only sequence numbers lower than the given one are removed.
+    ASSERT_TRUE(pit.try_to_remove_until(SequenceNumber_t(0, 2), writer_a));
+    ASSERT_EQ(nullptr, pit.find(SequenceNumber_t(0, 1), writer_a));
+    ASSERT_NE(nullptr, pit.find(SequenceNumber_t(0, 2), writer_a));
+    ASSERT_TRUE(pit.try_to_remove_until(SequenceNumber_t(0, 3), writer_a));
+    ASSERT_FALSE(pit.try_to_remove_until(SequenceNumber_t(0, 3), writer_a));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
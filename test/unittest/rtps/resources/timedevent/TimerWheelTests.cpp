@@ -0,0 +1,217 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/resources/TimerWheel.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace std::chrono;
+
+class TimerWheelTests : public ::testing::Test
+{
+    public:
+
+        TimerWheelTests()
+            : work_(service_)
+            , wheel_(asio::use_service<TimerWheel>(service_))
+        {
+        }
+
+        void SetUp()
+        {
+            thread_ = std::thread([this]()
+            {
+                service_.run();
+            });
+        }
+
+        void TearDown()
+        {
+            service_.stop();
+            thread_.join();
+        }
+
+        asio::io_service service_;
+
+        asio::io_service::work work_;
+
+        TimerWheel& wheel_;
+
+        std::thread thread_;
+};
+
+/*!
+ * @brief Entries scheduled on every level of the wheel are called once, and never before their expiration.
+ */
+TEST_F(TimerWheelTests, EntriesExpireInTime)
+{
+    const std::vector<milliseconds> delays =
+    {
+        milliseconds(0), milliseconds(1), milliseconds(30), milliseconds(63), milliseconds(64),
+        milliseconds(100), milliseconds(500), milliseconds(1100)
+    };
+
+    std::atomic<uint32_t> expired(0);
+    std::atomic<uint32_t> early(0);
+    std::vector<std::unique_ptr<TimerWheel::Entry>> entries;
+
+    auto start = steady_clock::now();
+    for (auto delay : delays)
+    {
+        auto expiration = start + delay;
+        entries.emplace_back(new TimerWheel::Entry(wheel_, [&expired, &early, expiration]()
+        {
+            if (steady_clock::now() < expiration)
+            {
+                ++early;
+            }
+            ++expired;
+        }));
+        entries.back()->schedule(expiration);
+    }
+
+    std::this_thread::sleep_for(milliseconds(1300));
+
+    ASSERT_EQ(expired.load(), delays.size());
+    ASSERT_EQ(early.load(), 0u);
+
+    for (auto& entry : entries)
+    {
+        ASSERT_FALSE(entry->is_scheduled());
+    }
+}
+
+/*!
+ * @brief Cancelled entries are not called, and rescheduled entries are called only on their last expiration.
+ */
+TEST_F(TimerWheelTests, CancelAndReschedule)
+{
+    std::atomic<uint32_t> cancelled_calls(0);
+    std::atomic<uint32_t> rescheduled_calls(0);
+    steady_clock::time_point rescheduled_time;
+
+    TimerWheel::Entry cancelled(wheel_, [&cancelled_calls]()
+    {
+        ++cancelled_calls;
+    });
+    TimerWheel::Entry rescheduled(wheel_, [&rescheduled_calls, &rescheduled_time]()
+    {
+        rescheduled_time = steady_clock::now();
+        ++rescheduled_calls;
+    });
+
+    auto start = steady_clock::now();
+    cancelled.schedule(start + milliseconds(50));
+    rescheduled.schedule(start + milliseconds(50));
+
+    ASSERT_TRUE(cancelled.is_scheduled());
+    cancelled.cancel();
+    ASSERT_FALSE(cancelled.is_scheduled());
+
+    rescheduled.schedule(start + milliseconds(200));
+
+    std::this_thread::sleep_for(milliseconds(400));
+
+    ASSERT_EQ(cancelled_calls.load(), 0u);
+    ASSERT_EQ(rescheduled_calls.load(), 1u);
+    ASSERT_GE(rescheduled_time, start + milliseconds(200));
+}
+
+/*!
+ * @brief A callback can schedule its own entry again.
+ */
+TEST_F(TimerWheelTests, PeriodicEntry)
+{
+    std::atomic<uint32_t> calls(0);
+    std::unique_ptr<TimerWheel::Entry> entry;
+
+    entry.reset(new TimerWheel::Entry(wheel_, [&calls, &entry]()
+    {
+        if (++calls < 5)
+        {
+            entry->schedule(steady_clock::now() + milliseconds(20));
+        }
+    }));
+    entry->schedule(steady_clock::now() + milliseconds(20));
+
+    std::this_thread::sleep_for(milliseconds(300));
+
+    ASSERT_EQ(calls.load(), 5u);
+}
+
+/*!
+ * @brief Many entries expiring at the same time are all called on the same wakeup.
+ */
+TEST_F(TimerWheelTests, ManyEntries)
+{
+    const uint32_t num_entries = 10000;
+    std::atomic<uint32_t> expired(0);
+    std::vector<std::unique_ptr<TimerWheel::Entry>> entries;
+
+    auto expiration = steady_clock::now() + milliseconds(100);
+    for (uint32_t i = 0; i < num_entries; ++i)
+    {
+        entries.emplace_back(new TimerWheel::Entry(wheel_, [&expired]()
+        {
+            ++expired;
+        }));
+        entries.back()->schedule(expiration + milliseconds(i % 3));
+    }
+
+    // Half of them are cancelled
+    for (uint32_t i = 0; i < num_entries; i += 2)
+    {
+        entries[i]->cancel();
+    }
+
+    std::this_thread::sleep_for(milliseconds(300));
+
+    ASSERT_EQ(expired.load(), num_entries / 2);
+}
+
+/*!
+ * @brief Destroying an entry waits for its running callback.
+ */
+TEST_F(TimerWheelTests, DestroyWaitsForCallback)
+{
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+
+    std::unique_ptr<TimerWheel::Entry> entry(new TimerWheel::Entry(wheel_, [&started, &finished]()
+    {
+        started = true;
+        std::this_thread::sleep_for(milliseconds(100));
+        finished = true;
+    }));
+    entry->schedule(steady_clock::now());
+
+    while (!started)
+    {
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+
+    entry.reset();
+    ASSERT_TRUE(finished.load());
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
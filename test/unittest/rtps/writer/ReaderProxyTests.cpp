@@ -103,6 +103,56 @@ TEST(ReaderProxyTests, find_change_removed_test)
     ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
 }
 
+TEST(ReaderProxyTests, requested_changes_set_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    ReaderProxy rproxy(wTimes, &writerMock);
+
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        ChangeForReader_t change(SequenceNumber_t(0, i));
+        change.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change, false);
+    }
+
+    ASSERT_TRUE(rproxy.has_unacknowledged());
+    ASSERT_FALSE(rproxy.perform_acknack_response());
+
+    // Change 6 does not exist
+    SequenceNumberSet_t requested(SequenceNumber_t(0, 2));
+    requested.add(SequenceNumber_t(0, 2));
+    requested.add(SequenceNumber_t(0, 4));
+    requested.add(SequenceNumber_t(0, 6));
+    ASSERT_TRUE(rproxy.requested_changes_set(requested));
+    ASSERT_FALSE(rproxy.requested_changes_set(requested));
+
+    // Requested changes become unsent
+    ASSERT_TRUE(rproxy.perform_acknack_response());
+    ASSERT_FALSE(rproxy.perform_acknack_response());
+
+    std::vector<SequenceNumber_t> unsent;
+    rproxy.for_each_unsent_change(SequenceNumber_t(0, 6),
+        [&unsent](const SequenceNumber_t& seq_num, const ChangeForReader_t* change)
+        {
+            if (change != nullptr)
+            {
+                unsent.push_back(seq_num);
+            }
+        });
+    ASSERT_EQ(unsent, std::vector<SequenceNumber_t>({SequenceNumber_t(0, 2), SequenceNumber_t(0, 4)}));
+
+    rproxy.acked_changes_set(SequenceNumber_t(0, 4));
+    ASSERT_TRUE(rproxy.has_unacknowledged());
+    ASSERT_TRUE(rproxy.change_is_acked(SequenceNumber_t(0, 3)));
+    ASSERT_FALSE(rproxy.change_is_acked(SequenceNumber_t(0, 4)));
+
+    rproxy.acked_changes_set(SequenceNumber_t(0, 6));
+    ASSERT_FALSE(rproxy.has_unacknowledged());
+    ASSERT_FALSE(rproxy.has_changes());
+    ASSERT_EQ(rproxy.changes_low_mark(), SequenceNumber_t(0, 5));
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,376 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/Semaphore.h>
+#include <fastrtps/transport/SharedMemTransport.h>
+#include <gtest/gtest.h>
+#include <MockReceiverResource.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static uint16_t g_default_port = 0;
+
+uint16_t get_port()
+{
+    uint16_t port = static_cast<uint16_t>(getpid());
+
+    if(4000 > port)
+    {
+        port += 4000;
+    }
+
+    return port;
+}
+
+class SharedMemTests: public ::testing::Test
+{
+    public:
+        SharedMemTests()
+        {
+            HELPER_SetDescriptorDefaults();
+        }
+
+        void HELPER_SetDescriptorDefaults();
+
+        SharedMemTransportDescriptor descriptor;
+};
+
+class CountingReceiver : public TransportReceiverInterface
+{
+    public:
+        CountingReceiver()
+            : received(0)
+            , sum(0)
+        {
+        }
+
+        void OnDataReceived(const octet* data, const uint32_t size,
+            const Locator_t&, const Locator_t&) override
+        {
+            uint32_t value = 0;
+            ASSERT_GE(size, sizeof(value));
+            memcpy(&value, data, sizeof(value));
+            sum += value;
+            ++received;
+        }
+
+        std::atomic<uint32_t> received;
+        std::atomic<uint64_t> sum;
+};
+
+TEST_F(SharedMemTests, locators_with_kind_shm_supported)
+{
+    // Given
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t supportedLocator;
+    supportedLocator.kind = LOCATOR_KIND_SHM;
+    Locator_t unsupportedLocator;
+    unsupportedLocator.kind = LOCATOR_KIND_UDPv4;
+
+    // Then
+    ASSERT_TRUE(transportUnderTest.IsLocatorSupported(supportedLocator));
+    ASSERT_FALSE(transportUnderTest.IsLocatorSupported(unsupportedLocator));
+}
+
+TEST_F(SharedMemTests, opening_and_closing_input_channel)
+{
+    // Given
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+    ASSERT_EQ(locators.size(), 1u);
+    Locator_t unicastLocator = *locators.begin();
+
+    // Then
+    ASSERT_FALSE (transportUnderTest.IsInputChannelOpen(unicastLocator));
+    ASSERT_TRUE  (transportUnderTest.OpenInputChannel(unicastLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE  (transportUnderTest.IsInputChannelOpen(unicastLocator));
+    ASSERT_TRUE  (transportUnderTest.CloseInputChannel(unicastLocator));
+    ASSERT_FALSE (transportUnderTest.IsInputChannelOpen(unicastLocator));
+    ASSERT_FALSE (transportUnderTest.CloseInputChannel(unicastLocator));
+}
+
+TEST_F(SharedMemTests, unicast_port_has_a_single_listener)
+{
+    SharedMemTransport firstTransport(descriptor);
+    ASSERT_TRUE(firstTransport.init());
+    SharedMemTransport secondTransport(descriptor);
+    ASSERT_TRUE(secondTransport.init());
+
+    LocatorList_t locators;
+    firstTransport.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t unicastLocator = *locators.begin();
+
+    ASSERT_TRUE(firstTransport.OpenInputChannel(unicastLocator, nullptr, 0x8FFF));
+    ASSERT_FALSE(secondTransport.OpenInputChannel(unicastLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(firstTransport.CloseInputChannel(unicastLocator));
+    ASSERT_TRUE(secondTransport.OpenInputChannel(unicastLocator, nullptr, 0x8FFF));
+    ASSERT_TRUE(secondTransport.CloseInputChannel(unicastLocator));
+}
+
+TEST_F(SharedMemTests, send_and_receive_between_transports)
+{
+    SharedMemTransport receiverTransport(descriptor);
+    ASSERT_TRUE(receiverTransport.init());
+    SharedMemTransport senderTransport(descriptor);
+    ASSERT_TRUE(senderTransport.init());
+
+    LocatorList_t locators;
+    receiverTransport.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t unicastLocator = *locators.begin();
+
+    MockReceiverResource receiver(receiverTransport, unicastLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiverTransport.IsInputChannelOpen(unicastLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(senderTransport.OpenOutputChannel(send_resource_list, unicastLocator));
+    ASSERT_EQ(send_resource_list.size(), 1u);
+    // The same resource is reused for any other port.
+    Locator_t otherLocator(unicastLocator);
+    otherLocator.port += 1;
+    ASSERT_TRUE(senderTransport.OpenOutputChannel(send_resource_list, otherLocator));
+    ASSERT_EQ(send_resource_list.size(), 1u);
+
+    octet message[5] = { 'H','e','l','l','o' };
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv->data,5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, unicastLocator));
+    sem.wait();
+
+    // Gather lists are written directly on the slot.
+    NetworkBufferList buffers;
+    buffers.emplace_back(message, 2);
+    buffers.emplace_back(message + 2, 3);
+    LocatorList_t destinations;
+    destinations.push_back(unicastLocator);
+    EXPECT_TRUE(send_resource_list.at(0)->send(buffers, 5, destinations));
+    sem.wait();
+}
+
+TEST_F(SharedMemTests, multicast_port_is_read_by_every_listener)
+{
+    SharedMemTransport firstTransport(descriptor);
+    ASSERT_TRUE(firstTransport.init());
+    SharedMemTransport secondTransport(descriptor);
+    ASSERT_TRUE(secondTransport.init());
+
+    LocatorList_t locators;
+    firstTransport.getDefaultMetatrafficMulticastLocators(locators, g_default_port);
+    Locator_t multicastLocator = *locators.begin();
+
+    CountingReceiver firstReceiver;
+    CountingReceiver secondReceiver;
+    ASSERT_TRUE(firstTransport.OpenInputChannel(multicastLocator, &firstReceiver, 0x8FFF));
+    ASSERT_TRUE(secondTransport.OpenInputChannel(multicastLocator, &secondReceiver, 0x8FFF));
+
+    uint32_t value = 1;
+    EXPECT_TRUE(firstTransport.send(reinterpret_cast<octet*>(&value), sizeof(value), multicastLocator));
+
+    for (uint32_t i = 0; i < 100 && (firstReceiver.received < 1 || secondReceiver.received < 1); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(firstReceiver.received, 1u);
+    EXPECT_EQ(secondReceiver.received, 1u);
+
+    firstTransport.CloseInputChannel(multicastLocator);
+    secondTransport.CloseInputChannel(multicastLocator);
+}
+
+TEST_F(SharedMemTests, concurrent_senders_do_not_lose_messages)
+{
+    const uint32_t num_senders = 4;
+    const uint32_t messages_per_sender = 500;
+
+    descriptor.port_queue_capacity = num_senders * messages_per_sender;
+
+    SharedMemTransport receiverTransport(descriptor);
+    ASSERT_TRUE(receiverTransport.init());
+    SharedMemTransport senderTransport(descriptor);
+    ASSERT_TRUE(senderTransport.init());
+
+    LocatorList_t locators;
+    receiverTransport.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t unicastLocator = *locators.begin();
+
+    CountingReceiver receiver;
+    ASSERT_TRUE(receiverTransport.OpenInputChannel(unicastLocator, &receiver, 0x8FFF));
+
+    std::vector<std::thread> senders;
+    for (uint32_t i = 0; i < num_senders; ++i)
+    {
+        senders.emplace_back([&, i]()
+        {
+            for (uint32_t j = 0; j < messages_per_sender; ++j)
+            {
+                uint32_t value = i * messages_per_sender + j;
+                EXPECT_TRUE(senderTransport.send(reinterpret_cast<octet*>(&value), sizeof(value), unicastLocator));
+            }
+        });
+    }
+
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+
+    const uint32_t total = num_senders * messages_per_sender;
+    for (uint32_t i = 0; i < 100 && receiver.received < total; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    uint64_t expected_sum = static_cast<uint64_t>(total) * (total - 1) / 2;
+    EXPECT_EQ(receiver.received, total);
+    EXPECT_EQ(receiver.sum, expected_sum);
+
+    receiverTransport.CloseInputChannel(unicastLocator);
+}
+
+TEST_F(SharedMemTests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
+{
+    descriptor.maxMessageSize = 1000;
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t unicastLocator = *locators.begin();
+
+    std::vector<octet> message(descriptor.maxMessageSize + 1, 0);
+    ASSERT_FALSE(transportUnderTest.send(message.data(), static_cast<uint32_t>(message.size()), unicastLocator));
+}
+
+TEST_F(SharedMemTests, send_to_port_without_listeners_does_not_create_segment)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t unicastLocator = *locators.begin();
+
+    octet message[5] = { 'H','e','l','l','o' };
+    ASSERT_FALSE(transportUnderTest.send(message, 5, unicastLocator));
+
+    std::string segment_file = "/dev/shm/" + descriptor.segment_name_prefix + "_" + std::to_string(g_default_port);
+    ASSERT_NE(access(segment_file.c_str(), F_OK), 0);
+}
+
+TEST_F(SharedMemTests, unused_segments_are_removed_on_init)
+{
+    std::string segment_name = "/" + descriptor.segment_name_prefix + "_" + std::to_string(g_default_port);
+    int fd = shm_open(segment_name.c_str(), O_CREAT | O_RDWR, 0666);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    fd = shm_open(segment_name.c_str(), O_RDWR, 0);
+    ASSERT_LT(fd, 0);
+}
+
+TEST_F(SharedMemTests, segments_are_created_with_the_configured_permissions)
+{
+    std::string segment_file = "/dev/shm/" + descriptor.segment_name_prefix + "_" + std::to_string(g_default_port);
+    struct stat segment_stat;
+
+    {
+        SharedMemTransport transportUnderTest(descriptor);
+        ASSERT_TRUE(transportUnderTest.init());
+
+        LocatorList_t locators;
+        transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+        ASSERT_TRUE(transportUnderTest.OpenInputChannel(*locators.begin(), nullptr, 0x8FFF));
+
+        ASSERT_EQ(stat(segment_file.c_str(), &segment_stat), 0);
+        ASSERT_EQ(segment_stat.st_mode & 0777, 0600u);
+    }
+
+    descriptor.segment_permissions = 0660;
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+    ASSERT_TRUE(transportUnderTest.OpenInputChannel(*locators.begin(), nullptr, 0x8FFF));
+
+    ASSERT_EQ(stat(segment_file.c_str(), &segment_stat), 0);
+    ASSERT_EQ(segment_stat.st_mode & 0777, 0660u);
+}
+
+TEST_F(SharedMemTests, locators_of_other_hosts_are_not_reachable)
+{
+    SharedMemTransport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    LocatorList_t locators;
+    transportUnderTest.getDefaultUnicastLocators(locators, g_default_port);
+    Locator_t localLocator = *locators.begin();
+    Locator_t remoteLocator(localLocator);
+    remoteLocator.address[15] ^= 0xFF;
+
+    ASSERT_TRUE(transportUnderTest.is_local_locator(localLocator));
+    ASSERT_FALSE(transportUnderTest.is_local_locator(remoteLocator));
+
+    octet message[5] = { 'H','e','l','l','o' };
+    ASSERT_FALSE(transportUnderTest.send(message, 5, remoteLocator));
+
+    LocatorList_t list;
+    list.push_back(localLocator);
+    list.push_back(remoteLocator);
+    LocatorList_t result = transportUnderTest.ShrinkLocatorLists({list});
+    ASSERT_EQ(result.size(), 1u);
+    ASSERT_TRUE(*result.begin() == localLocator);
+}
+
+void SharedMemTests::HELPER_SetDescriptorDefaults()
+{
+    descriptor.maxMessageSize = 5;
+    descriptor.port_queue_capacity = 16;
+    descriptor.segment_name_prefix = "fastrtps_shm_test_" + std::to_string(getpid());
+}
+
+int main(int argc, char **argv)
+{
+    g_default_port = get_port();
+
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -174,6 +174,123 @@ TEST_F(UDPv4Tests, send_and_receive_between_ports)
     sem.wait();
 }
 
+TEST_F(UDPv4Tests, send_and_receive_between_ports_with_batched_receive)
+{
+    descriptor.receive_batch_size = 8;
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator)); // Includes loopback
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(multicastLocator));
+    octet message[5] = { 'H','e','l','l','o' };
+    const int num_messages = 16;
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv->data,5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+    {
+        for (int i = 0; i < num_messages; ++i)
+        {
+            EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, multicastLocator));
+        }
+    };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    for (int i = 0; i < num_messages; ++i)
+    {
+        sem.wait();
+    }
+}
+
+TEST_F(UDPv4Tests, send_gather_list_to_several_locators)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t otherMulticastLocator = multicastLocator;
+    otherMulticastLocator.port = g_default_port + 2;
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    MockReceiverResource other_receiver(transportUnderTest, otherMulticastLocator);
+    MockMessageReceiver *other_msg_recv = dynamic_cast<MockMessageReceiver*>(other_receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator)); // Includes loopback
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(multicastLocator));
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(otherMulticastLocator));
+
+    octet header[2] = { 'H','e' };
+    octet body[3] = { 'l','l','o' };
+    octet message[5] = { 'H','e','l','l','o' };
+    NetworkBufferList buffers;
+    buffers.emplace_back(header, 2);
+    buffers.emplace_back(body, 3);
+
+    LocatorList_t destinations;
+    destinations.push_back(multicastLocator);
+    destinations.push_back(otherMulticastLocator);
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv->data,5), 0);
+        sem.post();
+    };
+    std::function<void()> otherRecCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,other_msg_recv->data,5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+    other_msg_recv->setCallback(otherRecCallback);
+
+    auto sendThreadFunction = [&]()
+    {
+        EXPECT_TRUE(send_resource_list.at(0)->send(buffers, 5, destinations));
+    };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    sem.wait();
+    sem.wait();
+}
+
 TEST_F(UDPv4Tests, send_to_loopback)
 {
     UDPv4Transport transportUnderTest(descriptor);
@@ -0,0 +1,122 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/utils/collections/RingBuffer.hpp>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+
+constexpr size_t NUM_ITEMS = 32;
+
+TEST(RingBufferTests, default_constructor)
+{
+    RingBuffer<int> uut;
+
+    // Should be empty and non-allocated
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.capacity(), 0u);
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        uut.push_back(static_cast<int>(i));
+    }
+
+    // Capacity grows in powers of two
+    ASSERT_EQ(uut.size(), NUM_ITEMS);
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+    ASSERT_EQ(uut.front(), 0);
+    ASSERT_EQ(uut.back(), static_cast<int>(NUM_ITEMS - 1));
+
+    for (size_t i = 0; i < NUM_ITEMS; ++i)
+    {
+        ASSERT_EQ(uut[i], static_cast<int>(i));
+    }
+}
+
+TEST(RingBufferTests, initial_capacity)
+{
+    RingBuffer<int> uut(NUM_ITEMS - 1);
+
+    // Capacity is rounded up to a power of two
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+}
+
+TEST(RingBufferTests, wrap_around)
+{
+    RingBuffer<int> uut(NUM_ITEMS);
+    int next_in = 0;
+    int next_out = 0;
+
+    // Keep half of the buffer filled while pushing several times its capacity
+    for (size_t i = 0; i < NUM_ITEMS / 2; ++i)
+    {
+        uut.push_back(next_in++);
+    }
+
+    for (size_t i = 0; i < 4 * NUM_ITEMS; ++i)
+    {
+        uut.push_back(next_in++);
+        ASSERT_EQ(uut.front(), next_out);
+        uut.pop_front();
+        ++next_out;
+        ASSERT_EQ(uut.back(), next_in - 1);
+    }
+
+    // No allocation should have been performed
+    ASSERT_EQ(uut.size(), NUM_ITEMS / 2);
+    ASSERT_EQ(uut.capacity(), NUM_ITEMS);
+
+    for (size_t i = 0; i < uut.size(); ++i)
+    {
+        ASSERT_EQ(uut[i], next_out + static_cast<int>(i));
+    }
+}
+
+TEST(RingBufferTests, grow_keeps_order)
+{
+    RingBuffer<int> uut(NUM_ITEMS);
+
+    // Move the front away from the start of the buffer
+    for (size_t i = 0; i < NUM_ITEMS / 2; ++i)
+    {
+        uut.push_back(-1);
+        uut.pop_front();
+    }
+
+    // Fill more than the capacity, so the buffer grows while wrapped
+    for (size_t i = 0; i < NUM_ITEMS + 1; ++i)
+    {
+        uut.push_back(static_cast<int>(i));
+    }
+
+    ASSERT_EQ(uut.size(), NUM_ITEMS + 1);
+    ASSERT_EQ(uut.capacity(), 2 * NUM_ITEMS);
+
+    for (size_t i = 0; i < uut.size(); ++i)
+    {
+        ASSERT_EQ(uut[i], static_cast<int>(i));
+    }
+
+    // Clear keeps capacity
+    uut.clear();
+    ASSERT_TRUE(uut.empty());
+    ASSERT_EQ(uut.capacity(), 2 * NUM_ITEMS);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -102,6 +102,8 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     locator.port = 1979;
     EXPECT_EQ(rtps_atts.sendSocketBufferSize, 32u);
     EXPECT_EQ(rtps_atts.listenSocketBufferSize, 1000u);
+    EXPECT_EQ(rtps_atts.asyncWriterThreads, 2u);
+    EXPECT_EQ(rtps_atts.intraprocessDelivery, true);
     EXPECT_EQ(builtin.use_SIMPLE_RTPSParticipantDiscoveryProtocol, true);
     EXPECT_EQ(builtin.use_WriterLivelinessProtocol, false);
     EXPECT_EQ(builtin.use_SIMPLE_EndpointDiscoveryProtocol, true);
@@ -142,6 +144,7 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     EXPECT_EQ(rtps_atts.participantID, 9898);
     EXPECT_EQ(rtps_atts.throughputController.bytesPerPeriod, 2048u);
     EXPECT_EQ(rtps_atts.throughputController.periodMillisecs, 45u);
+    EXPECT_EQ(rtps_atts.throughputController.burstSize, 4096u);
     EXPECT_EQ(rtps_atts.useBuiltinTransports, true);
     EXPECT_EQ(std::string(rtps_atts.getName()), "test_name");
 }
@@ -171,6 +174,8 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultParcipantProfile)
     locator.port = 1979;
     EXPECT_EQ(rtps_atts.sendSocketBufferSize, 32u);
     EXPECT_EQ(rtps_atts.listenSocketBufferSize, 1000u);
+    EXPECT_EQ(rtps_atts.asyncWriterThreads, 2u);
+    EXPECT_EQ(rtps_atts.intraprocessDelivery, true);
     EXPECT_EQ(builtin.use_SIMPLE_RTPSParticipantDiscoveryProtocol, true);
     EXPECT_EQ(builtin.use_WriterLivelinessProtocol, false);
     EXPECT_EQ(builtin.use_SIMPLE_EndpointDiscoveryProtocol, true);
@@ -211,6 +216,7 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultParcipantProfile)
     EXPECT_EQ(rtps_atts.participantID, 9898);
     EXPECT_EQ(rtps_atts.throughputController.bytesPerPeriod, 2048u);
     EXPECT_EQ(rtps_atts.throughputController.periodMillisecs, 45u);
+    EXPECT_EQ(rtps_atts.throughputController.burstSize, 4096u);
     EXPECT_EQ(rtps_atts.useBuiltinTransports, true);
     EXPECT_EQ(std::string(rtps_atts.getName()), "test_name");
 }
@@ -278,6 +284,7 @@ TEST_F(XMLProfileParserTests, XMLParserPublisher)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.throughputController.priority, 3);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);
@@ -346,6 +353,7 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultPublisherProfile)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.throughputController.priority, 3);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);
@@ -637,6 +645,7 @@ TEST_F(XMLProfileParserTests, UDP_transport_descriptors_config)
     EXPECT_EQ(descriptor->receiveBufferSize, 8192u);
     EXPECT_EQ(descriptor->TTL, 250u);
     EXPECT_EQ(descriptor->non_blocking_send, true);
+    EXPECT_EQ(descriptor->receive_batch_size, 32u);
     EXPECT_EQ(descriptor->maxMessageSize, 16384u);
     EXPECT_EQ(descriptor->maxInitialPeersRange, 100u);
     EXPECT_EQ(descriptor->interfaceWhiteList.size(), 2u);